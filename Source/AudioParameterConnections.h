@@ -190,251 +190,481 @@ m_value_tree_misc.addListener(&m_non_param_listener_misc);
 m_value_tree_mod.addListener(&m_non_param_listener_mod);
 m_value_tree_osc.addListener(&m_non_param_listener_osc);
 
+// every parameter gets its handler here, the osc, filter or step index is bound once.
+// the handlers run on the audio thread at the start of a block, see OdinParameterDispatcher
 for (int osc = 0; osc < 3; ++osc) {
-	//osc pitch listener:
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_oct", &m_tree_listener_osc_pitch);
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_semi", &m_tree_listener_osc_pitch);
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_fine", &m_tree_listener_osc_pitch);
-
-	//osc misc listener:
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_vol", &m_tree_listener_osc_misc);
+	const std::string osc_prefix = "osc" + std::to_string(osc + 1);
+
+	//osc pitch
+	m_parameter_dispatcher.attach(m_value_tree, osc_prefix + "_oct", [&, osc](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].setOctave(p_value, osc);
+		}
+	});
+	m_parameter_dispatcher.attach(m_value_tree, osc_prefix + "_semi", [&, osc](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].setSemitones(p_value, osc);
+		}
+	});
+	m_parameter_dispatcher.attach(m_value_tree, osc_prefix + "_fine", [&, osc](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].setFinetune(p_value, osc);
+		}
+	});
+
+	//osc misc
+	m_parameter_dispatcher.attach(m_value_tree, osc_prefix + "_vol", [&, osc](float p_value) {
+		m_osc_vol_control[osc] = Decibels::decibelsToGain(p_value, -59.99f);
+	});
 	if (osc != 0) {
-		m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_sync", &m_tree_listener_osc_misc);
+		m_parameter_dispatcher.attach(m_value_tree, osc_prefix + "_sync", [&, osc](float p_value) {
+			for (int voice = 0; voice < VOICES; ++voice) {
+				m_voice[voice].setOscSyncEnabled(p_value, osc);
+			}
+		});
+	}
+	m_parameter_dispatcher.attach(m_value_tree, osc_prefix + "_reset", [&, osc](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].setReset(p_value, osc);
+		}
+	});
+
+	//osc analog
+	m_parameter_dispatcher.attach(m_value_tree, osc_prefix + "_pulsewidth", [&, osc](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].analog_osc[osc].setPWMDuty(p_value);
+		}
+	});
+	m_parameter_dispatcher.attach(m_value_tree, osc_prefix + "_drift", [&, osc](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].analog_osc[osc].setDrift(p_value);
+		}
+	});
+
+	//osc multi & wavetable
+	m_parameter_dispatcher.attach(m_value_tree, osc_prefix + "_position", [&, osc](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].wavetable_osc[osc].setPosition(p_value);
+		}
+	});
+	m_parameter_dispatcher.attach(m_value_tree, osc_prefix + "_detune", [&, osc](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].multi_osc[osc].setDetune(p_value);
+		}
+	});
+	m_parameter_dispatcher.attach(m_value_tree, osc_prefix + "_pos_mod", [&, osc](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].wavetable_osc[osc].setPosModAmount(p_value);
+		}
+	});
+	m_parameter_dispatcher.attach(m_value_tree, osc_prefix + "_multi_position", [&, osc](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].multi_osc[osc].setPosition(p_value);
+		}
+	});
+	m_parameter_dispatcher.attach(m_value_tree, osc_prefix + "_spread", [&, osc](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].multi_osc[osc].setWavetableMultiSpread(p_value);
+		}
+	});
+
+	//osc xy
+	m_parameter_dispatcher.attach(m_value_tree, osc_prefix + "_vec_x", [&, osc](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].vector_osc[osc].setX(p_value);
+		}
+	});
+	m_parameter_dispatcher.attach(m_value_tree, osc_prefix + "_vec_y", [&, osc](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].vector_osc[osc].setY(p_value);
+		}
+	});
+
+	//osc chip
+	m_parameter_dispatcher.attach(m_value_tree, osc_prefix + "_chipnoise", [&, osc](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].chiptune_osc[osc].setNoiseEnabled(p_value);
+		}
+	});
+	m_parameter_dispatcher.attach(m_value_tree, osc_prefix + "_arp_speed", [&, osc](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].chiptune_osc[osc].setArpSpeed(p_value);
+		}
+	});
+	m_parameter_dispatcher.attach(m_value_tree, osc_prefix + "_arp_on", [&, osc](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].chiptune_osc[osc].setArpEnabled(p_value);
+		}
+	});
+
+	//osc arp
+	for (int step = 0; step < 3; ++step) {
+		m_parameter_dispatcher.attach(
+		    m_value_tree, osc_prefix + "_step_" + std::to_string(step + 1), [&, osc, step](float p_value) {
+			    for (int voice = 0; voice < VOICES; ++voice) {
+				    m_voice[voice].chiptune_osc[osc].setArpSemitone(step, p_value);
+			    }
+		    });
 	}
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_reset", &m_tree_listener_osc_misc);
-
-	//osc analog listener
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_pulsewidth", &m_tree_listener_osc_analog);
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_drift", &m_tree_listener_osc_analog);
-
-	//osc multi listener
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_position", &m_tree_listener_osc_multi);
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_detune", &m_tree_listener_osc_multi);
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_pos_mod", &m_tree_listener_osc_multi);
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_multi_position", &m_tree_listener_osc_multi);
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_spread", &m_tree_listener_osc_multi);
-
-	//osc xy listener
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_vec_x", &m_tree_listener_osc_xy);
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_vec_y", &m_tree_listener_osc_xy);
-
-	//osc chip listener
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_chipnoise", &m_tree_listener_osc_chip);
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_arp_speed", &m_tree_listener_osc_chip);
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_arp_on", &m_tree_listener_osc_chip);
-
-	//osc arp listener
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_step_1", &m_tree_listener_osc_arp);
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_step_2", &m_tree_listener_osc_arp);
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_step_3", &m_tree_listener_osc_arp);
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_step_3_on", &m_tree_listener_osc_arp);
-
-	//osc fm listener
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_fm", &m_tree_listener_osc_fm);
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_exp_fm", &m_tree_listener_osc_fm);
-	//m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_carrier_ratio", &m_tree_listener_osc_fm);
-	//m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_modulator_ratio", &m_tree_listener_osc_fm);
-
-	//osc noiselistener
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_lp", &m_tree_listener_osc_noise);
-	m_value_tree.addParameterListener("osc" + std::to_string(osc + 1) + "_hp", &m_tree_listener_osc_noise);
+	m_parameter_dispatcher.attach(m_value_tree, osc_prefix + "_step_3_on", [&, osc](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].chiptune_osc[osc].setArpStepThreeOn(p_value);
+		}
+	});
+
+	//osc fm
+	m_parameter_dispatcher.attach(m_value_tree, osc_prefix + "_fm", [&, osc](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].fm_osc[osc].setFMAmount(p_value);
+			m_voice[voice].pm_osc[osc].setPMAmount(p_value);
+		}
+	});
+	m_parameter_dispatcher.attach(m_value_tree, osc_prefix + "_exp_fm", [&, osc](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].fm_osc[osc].setFMExponential(p_value);
+		}
+	});
+	//osc_carrier_ratio and osc_modulator_ratio are read in treeValueChangedNonParamOsc()
+
+	//osc noise
+	m_parameter_dispatcher.attach(m_value_tree, osc_prefix + "_lp", [&, osc](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].noise_osc[osc].setLPFreq(p_value);
+		}
+	});
+	m_parameter_dispatcher.attach(m_value_tree, osc_prefix + "_hp", [&, osc](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].noise_osc[osc].setHPFreq(p_value);
+		}
+	});
 }
 
-for (int fil = 0; fil < 3; ++fil) {
-	//fil top listener
-	m_value_tree.addParameterListener("fil" + std::to_string(fil + 1) + "_vel", &m_tree_listener_fil_top);
-	m_value_tree.addParameterListener("fil" + std::to_string(fil + 1) + "_env", &m_tree_listener_fil_top);
-	m_value_tree.addParameterListener("fil" + std::to_string(fil + 1) + "_kbd", &m_tree_listener_fil_top);
-	m_value_tree.addParameterListener("fil" + std::to_string(fil + 1) + "_gain", &m_tree_listener_fil_top);
-
-	//fil center listener
-	m_value_tree.addParameterListener("fil" + std::to_string(fil + 1) + "_freq", &m_tree_listener_fil_center);
-	m_value_tree.addParameterListener("fil" + std::to_string(fil + 1) + "_res", &m_tree_listener_fil_center);
-	m_value_tree.addParameterListener("fil" + std::to_string(fil + 1) + "_saturation", &m_tree_listener_fil_center);
-
-	//fil misc listener
-	m_value_tree.addParameterListener("fil" + std::to_string(fil + 1) + "_ring_mod_amount", &m_tree_listener_fil_misc);
-	m_value_tree.addParameterListener("fil" + std::to_string(fil + 1) + "_sem_transition", &m_tree_listener_fil_misc);
-	//m_value_tree.addParameterListener("fil" + std::to_string(fil + 1) + "_comb_polarity", &m_tree_listener_fil_misc);
-
-	//fil formant listener
-	m_value_tree.addParameterListener("fil" + std::to_string(fil + 1) + "_formant_transition",
-	                                  &m_tree_listener_fil_formant);
-	//m_value_tree.addParameterListener("fil" + std::to_string(fil + 1) + "_vowel_left", &m_tree_listener_fil_formant);
-	//m_value_tree.addParameterListener("fil" + std::to_string(fil + 1) + "_vowel_right", &m_tree_listener_fil_formant);
+// filter 1 & 2 are per voice
+for (int fil = 0; fil < 2; ++fil) {
+	const std::string fil_prefix = "fil" + std::to_string(fil + 1);
+
+	m_parameter_dispatcher.attach(m_value_tree, fil_prefix + "_vel", [&, fil](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].setVelModAmount(p_value, fil);
+		}
+	});
+	m_parameter_dispatcher.attach(m_value_tree, fil_prefix + "_env", [&, fil](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].setEnvModAmount(p_value, fil);
+		}
+	});
+	m_parameter_dispatcher.attach(m_value_tree, fil_prefix + "_kbd", [&, fil](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].setKbd(p_value, fil);
+		}
+	});
+	m_parameter_dispatcher.attach(m_value_tree, fil_prefix + "_gain", [&, fil](float p_value) {
+		m_fil_gain_control[fil] = Decibels::decibelsToGain(p_value, -59.99f);
+	});
+	m_parameter_dispatcher.attach(m_value_tree, fil_prefix + "_freq", [&, fil](float p_value) {
+		m_fil_freq_control[fil] = p_value;
+	});
+	m_parameter_dispatcher.attach(m_value_tree, fil_prefix + "_res", [&, fil](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].setFilterRes(p_value, fil);
+		}
+	});
+	m_parameter_dispatcher.attach(m_value_tree, fil_prefix + "_saturation", [&, fil](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].setSaturation(p_value * 2, fil);
+		}
+	});
+	m_parameter_dispatcher.attach(m_value_tree, fil_prefix + "_ring_mod_amount", [&, fil](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].ring_mod[fil].setAmount(p_value);
+		}
+	});
+	m_parameter_dispatcher.attach(m_value_tree, fil_prefix + "_sem_transition", [&, fil](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].SEM_filter_12[fil].m_transition = p_value;
+		}
+	});
+	m_parameter_dispatcher.attach(m_value_tree, fil_prefix + "_formant_transition", [&, fil](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].formant_filter[fil].setTransition(p_value);
+		}
+	});
+}
+
+// filter 3 is stereo after the voices
+m_parameter_dispatcher.attach(m_value_tree, "fil3_vel", [&](float p_value) {
+	for (int channel = 0; channel < 2; ++channel) {
+		m_ladder_filter[channel].m_vel_mod_amount  = p_value;
+		m_SEM_filter_12[channel].m_vel_mod_amount  = p_value;
+		m_korg_filter[channel].m_vel_mod_amount    = p_value;
+		m_diode_filter[channel].m_vel_mod_amount   = p_value;
+		m_comb_filter[channel].m_vel_mod_amount    = p_value;
+		m_ring_mod[channel].m_vel_mod_amount       = p_value;
+		m_formant_filter[channel].m_vel_mod_amount = p_value;
+	}
+});
+m_parameter_dispatcher.attach(m_value_tree, "fil3_env", [&](float p_value) {
+	for (int channel = 0; channel < 2; ++channel) {
+		m_ladder_filter[channel].m_env_mod_amount  = p_value;
+		m_SEM_filter_12[channel].m_env_mod_amount  = p_value;
+		m_korg_filter[channel].m_env_mod_amount    = p_value;
+		m_diode_filter[channel].m_env_mod_amount   = p_value;
+		m_comb_filter[channel].m_env_mod_amount    = p_value;
+		m_ring_mod[channel].m_env_mod_amount       = p_value;
+		m_formant_filter[channel].m_env_mod_amount = p_value;
+	}
+});
+m_parameter_dispatcher.attach(m_value_tree, "fil3_kbd", [&](float p_value) {
+	for (int channel = 0; channel < 2; ++channel) {
+		m_ladder_filter[channel].m_kbd_mod_amount = p_value;
+		m_SEM_filter_12[channel].m_kbd_mod_amount = p_value;
+		m_korg_filter[channel].m_kbd_mod_amount   = p_value;
+		m_diode_filter[channel].m_kbd_mod_amount  = p_value;
+		m_comb_filter[channel].m_kbd_mod_amount   = p_value;
+		m_ring_mod[channel].m_kbd_mod_amount      = p_value;
+	}
+});
+m_parameter_dispatcher.attach(m_value_tree, "fil3_gain", [&](float p_value) {
+	m_fil_gain_control[2] = Decibels::decibelsToGain(p_value, -59.99f);
+});
+m_parameter_dispatcher.attach(m_value_tree, "fil3_freq", [&](float p_value) {
+	m_fil_freq_control[2] = p_value;
+});
+m_parameter_dispatcher.attach(m_value_tree, "fil3_res", [&](float p_value) {
+	for (int channel = 0; channel < 2; ++channel) {
+		m_ladder_filter[channel].setResControl(p_value);
+		m_SEM_filter_12[channel].setResControl(p_value);
+		m_korg_filter[channel].setResControl(p_value);
+		m_diode_filter[channel].setResControl(p_value);
+		m_comb_filter[channel].setResonance(p_value);
+	}
+});
+m_parameter_dispatcher.attach(m_value_tree, "fil3_saturation", [&](float p_value) {
+	for (int channel = 0; channel < 2; ++channel) {
+		m_ladder_filter[channel].m_overdrive = p_value * 2;
+		m_SEM_filter_12[channel].m_overdrive = p_value * 2;
+		m_korg_filter[channel].m_overdrive   = p_value * 2;
+		m_diode_filter[channel].m_overdrive  = p_value * 2;
+	}
+});
+m_parameter_dispatcher.attach(m_value_tree, "fil3_ring_mod_amount", [&](float p_value) {
+	m_ring_mod[0].setAmount(p_value);
+	m_ring_mod[1].setAmount(p_value);
+});
+m_parameter_dispatcher.attach(m_value_tree, "fil3_sem_transition", [&](float p_value) {
+	m_SEM_filter_12[0].m_transition = p_value;
+	m_SEM_filter_12[1].m_transition = p_value;
+});
+m_parameter_dispatcher.attach(m_value_tree, "fil3_formant_transition", [&](float p_value) {
+	m_formant_filter[0].setTransition(p_value);
+	m_formant_filter[1].setTransition(p_value);
+});
+
+//amp & distortion
+m_parameter_dispatcher.attach(m_value_tree, "amp_pan", [&](float p_value) {
+	for (int voice = 0; voice < VOICES; ++voice) {
+		m_voice[voice].amp.setPan(p_value);
+	}
+});
+m_parameter_dispatcher.attach(m_value_tree, "amp_gain", [&](float p_value) {
+	for (int voice = 0; voice < VOICES; ++voice) {
+		m_voice[voice].amp.setGainDecibels(p_value);
+	}
+});
+m_parameter_dispatcher.attach(m_value_tree, "amp_velocity", [&](float p_value) {
+	for (int voice = 0; voice < VOICES; ++voice) {
+		m_voice[voice].amp.setVelocityAmount(p_value);
+	}
+});
+m_parameter_dispatcher.attach(m_value_tree, "dist_boost", [&](float p_value) {
+	for (int voice = 0; voice < VOICES; ++voice) {
+		m_voice[voice].distortion[0].setThreshold(p_value);
+		m_voice[voice].distortion[1].setThreshold(p_value);
+	}
+});
+m_parameter_dispatcher.attach(m_value_tree, "dist_drywet", [&](float p_value) {
+	for (int voice = 0; voice < VOICES; ++voice) {
+		m_voice[voice].distortion[0].setDryWet(p_value);
+		m_voice[voice].distortion[1].setDryWet(p_value);
+	}
+});
+
+//delay
+m_parameter_dispatcher.attach(m_value_tree, "delay_time", [&](float p_value) { m_delay.setDelayTime(p_value); });
+m_parameter_dispatcher.attach(m_value_tree, "delay_feedback", [&](float p_value) { m_delay.setFeedback(p_value); });
+m_parameter_dispatcher.attach(m_value_tree, "delay_hp", [&](float p_value) { m_delay.setHPFreq(p_value); });
+m_parameter_dispatcher.attach(m_value_tree, "delay_ducking", [&](float p_value) { m_delay.setDucking(p_value); });
+m_parameter_dispatcher.attach(m_value_tree, "delay_dry", [&](float p_value) { m_delay.setDry(p_value); });
+m_parameter_dispatcher.attach(m_value_tree, "delay_wet", [&](float p_value) { m_delay.setWet(p_value); });
+m_parameter_dispatcher.attach(m_value_tree, "delay_pingpong", [&](float p_value) { m_delay.setPingPong(p_value > 0.5f); });
+m_parameter_dispatcher.attach(m_value_tree, "delay_on", [&](float) { m_delay.reset(); });
+
+//reverb
+m_parameter_dispatcher.attach(m_value_tree, "rev_eqfreq", [&](float p_value) { m_reverb_zita.set_eq1_freq(p_value); });
+m_parameter_dispatcher.attach(m_value_tree, "rev_eqgain", [&](float p_value) { m_reverb_zita.set_eq1_gain(p_value); });
+m_parameter_dispatcher.attach(m_value_tree, "rev_drywet", [&](float p_value) { m_reverb_zita.set_opmix(p_value); });
+m_parameter_dispatcher.attach(m_value_tree, "rev_delay", [&](float p_value) {
+	m_reverb_zita.set_delay(p_value / 1000.f);
+});
+m_parameter_dispatcher.attach(m_value_tree, "reverb_on", [&](float p_value) {
+	if (p_value > 0.5f) {
+		m_reverb_zita.reset();
+	}
+});
+m_parameter_dispatcher.attach(m_value_tree, "rev_mid_hall", [&](float p_value) { m_reverb_zita.set_rtmid(p_value); });
+m_parameter_dispatcher.attach(m_value_tree, "rev_hf_damp", [&](float p_value) { m_reverb_zita.set_fdamp(p_value); });
+
+//chorus
+m_parameter_dispatcher.attach(m_value_tree, "chorus_rate", [&](float p_value) {
+	m_chorus[0].setLFOFreq(p_value);
+	m_chorus[1].setLFOFreq(p_value);
+});
+m_parameter_dispatcher.attach(m_value_tree, "chorus_amount", [&](float p_value) {
+	m_chorus[0].setAmount(p_value);
+	m_chorus[1].setAmount(p_value);
+});
+m_parameter_dispatcher.attach(m_value_tree, "chorus_drywet", [&](float p_value) {
+	m_chorus[0].setDryWet(p_value);
+	m_chorus[1].setDryWet(p_value);
+});
+m_parameter_dispatcher.attach(m_value_tree, "chorus_feedback", [&](float p_value) {
+	m_chorus[0].setFeedback(p_value);
+	m_chorus[1].setFeedback(p_value);
+});
+
+//phaser
+m_parameter_dispatcher.attach(m_value_tree, "phaser_rate", [&](float p_value) { m_phaser.setLFOFreq(p_value); });
+m_parameter_dispatcher.attach(m_value_tree, "phaser_freq", [&](float p_value) { m_phaser.setBaseFreq(p_value); });
+m_parameter_dispatcher.attach(m_value_tree, "phaser_feedback", [&](float p_value) { m_phaser.setFeedback(p_value); });
+m_parameter_dispatcher.attach(m_value_tree, "phaser_mod", [&](float p_value) { m_phaser.setLFOAmplitude(p_value); });
+m_parameter_dispatcher.attach(m_value_tree, "phaser_drywet", [&](float p_value) { m_phaser.setDryWet(p_value); });
+
+//flanger
+m_parameter_dispatcher.attach(m_value_tree, "flanger_rate", [&](float p_value) {
+	m_flanger[0].setLFOFreq(p_value);
+	m_flanger[1].setLFOFreq(p_value);
+});
+m_parameter_dispatcher.attach(m_value_tree, "flanger_amount", [&](float p_value) {
+	m_flanger[0].setLFOAmount(p_value);
+	m_flanger[1].setLFOAmount(p_value);
+});
+m_parameter_dispatcher.attach(m_value_tree, "flanger_drywet", [&](float p_value) {
+	m_flanger[0].setDryWet(p_value);
+	m_flanger[1].setDryWet(p_value);
+});
+m_parameter_dispatcher.attach(m_value_tree, "flanger_feedback", [&](float p_value) {
+	m_flanger[0].setFeedback(p_value);
+	m_flanger[1].setFeedback(p_value);
+});
+
+//adsr 1 - 3 are per voice
+for (int env = 0; env < 3; ++env) {
+	const std::string env_prefix = "env" + std::to_string(env + 1);
+
+	m_parameter_dispatcher.attach(m_value_tree, env_prefix + "_attack", [&, env](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].env[env].setAttack(p_value);
+		}
+	});
+	m_parameter_dispatcher.attach(m_value_tree, env_prefix + "_decay", [&, env](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].env[env].setDecay(p_value);
+		}
+	});
+	m_parameter_dispatcher.attach(m_value_tree, env_prefix + "_sustain", [&, env](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].env[env].setSustain(p_value);
+		}
+	});
+	m_parameter_dispatcher.attach(m_value_tree, env_prefix + "_release", [&, env](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].env[env].setRelease(p_value);
+		}
+	});
+	m_parameter_dispatcher.attach(m_value_tree, env_prefix + "_loop", [&, env](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].env[env].setLoop(p_value);
+		}
+	});
+}
+
+//adsr 4 is global
+m_parameter_dispatcher.attach(m_value_tree, "env4_attack", [&](float p_value) { m_global_env.setAttack(p_value); });
+m_parameter_dispatcher.attach(m_value_tree, "env4_decay", [&](float p_value) { m_global_env.setDecay(p_value); });
+m_parameter_dispatcher.attach(m_value_tree, "env4_sustain", [&](float p_value) { m_global_env.setSustain(p_value); });
+m_parameter_dispatcher.attach(m_value_tree, "env4_release", [&](float p_value) { m_global_env.setRelease(p_value); });
+m_parameter_dispatcher.attach(m_value_tree, "env4_loop", [&](float p_value) { m_global_env.setLoop(p_value); });
+
+//lfo 1 - 3 are per voice
+for (int lfo = 0; lfo < 3; ++lfo) {
+	const std::string lfo_prefix = "lfo" + std::to_string(lfo + 1);
+
+	m_parameter_dispatcher.attach(m_value_tree, lfo_prefix + "_freq", [&, lfo](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].lfo[lfo].setBaseFrequency(p_value);
+		}
+	});
+	m_parameter_dispatcher.attach(m_value_tree, lfo_prefix + "_reset", [&, lfo](float p_value) {
+		for (int voice = 0; voice < VOICES; ++voice) {
+			m_voice[voice].lfo[lfo].setResetActive(p_value > 0.5f);
+		}
+	});
 }
 
-//amp listener
-m_value_tree.addParameterListener("amp_pan", &m_tree_listener_amp);
-m_value_tree.addParameterListener("amp_gain", &m_tree_listener_amp);
-m_value_tree.addParameterListener("amp_velocity", &m_tree_listener_amp);
-m_value_tree.addParameterListener("dist_boost", &m_tree_listener_amp);
-m_value_tree.addParameterListener("dist_drywet", &m_tree_listener_amp);
-
-//delay listener
-m_value_tree.addParameterListener("delay_time", &m_tree_listener_delay);
-m_value_tree.addParameterListener("delay_feedback", &m_tree_listener_delay);
-m_value_tree.addParameterListener("delay_hp", &m_tree_listener_delay);
-m_value_tree.addParameterListener("delay_ducking", &m_tree_listener_delay);
-m_value_tree.addParameterListener("delay_dry", &m_tree_listener_delay);
-m_value_tree.addParameterListener("delay_wet", &m_tree_listener_delay);
-m_value_tree.addParameterListener("delay_pingpong", &m_tree_listener_delay);
-m_value_tree.addParameterListener("delay_on", &m_tree_listener_delay);
-
-//reverb listener
-m_value_tree.addParameterListener("rev_eqfreq", &m_tree_listener_reverb);
-m_value_tree.addParameterListener("rev_eqgain", &m_tree_listener_reverb);
-//m_value_tree.addParameterListener("rev_ducking", &m_tree_listener_reverb);
-m_value_tree.addParameterListener("rev_drywet", &m_tree_listener_reverb);
-m_value_tree.addParameterListener("rev_delay", &m_tree_listener_reverb);
-m_value_tree.addParameterListener("reverb_on", &m_tree_listener_reverb);
-m_value_tree.addParameterListener("rev_mid_hall", &m_tree_listener_reverb);
-m_value_tree.addParameterListener("rev_hf_damp", &m_tree_listener_reverb);
-
-//chorus listener
-m_value_tree.addParameterListener("chorus_rate", &m_tree_listener_chorus);
-m_value_tree.addParameterListener("chorus_amount", &m_tree_listener_chorus);
-m_value_tree.addParameterListener("chorus_drywet", &m_tree_listener_chorus);
-m_value_tree.addParameterListener("chorus_feedback", &m_tree_listener_chorus);
-m_value_tree.addParameterListener("chorus_reset", &m_tree_listener_chorus);
-m_value_tree.addParameterListener("chorus_on", &m_tree_listener_chorus);
-
-//phaser listener
-m_value_tree.addParameterListener("phaser_rate", &m_tree_listener_phaser);
-m_value_tree.addParameterListener("phaser_freq", &m_tree_listener_phaser);
-m_value_tree.addParameterListener("phaser_feedback", &m_tree_listener_phaser);
-m_value_tree.addParameterListener("phaser_mod", &m_tree_listener_phaser);
-m_value_tree.addParameterListener("phaser_drywet", &m_tree_listener_phaser);
-m_value_tree.addParameterListener("phaser_reset", &m_tree_listener_phaser);
-m_value_tree.addParameterListener("phaser_on", &m_tree_listener_phaser);
-
-//flanger listener
-m_value_tree.addParameterListener("flanger_rate", &m_tree_listener_flanger);
-m_value_tree.addParameterListener("flanger_amount", &m_tree_listener_flanger);
-m_value_tree.addParameterListener("flanger_drywet", &m_tree_listener_flanger);
-m_value_tree.addParameterListener("flanger_feedback", &m_tree_listener_flanger);
-m_value_tree.addParameterListener("flanger_reset", &m_tree_listener_flanger);
-m_value_tree.addParameterListener("flanger_on", &m_tree_listener_flanger);
-
-//adsr1 listener
-m_value_tree.addParameterListener("env1_attack", &m_tree_listener_adsr1);
-m_value_tree.addParameterListener("env1_decay", &m_tree_listener_adsr1);
-m_value_tree.addParameterListener("env1_sustain", &m_tree_listener_adsr1);
-m_value_tree.addParameterListener("env1_release", &m_tree_listener_adsr1);
-m_value_tree.addParameterListener("env1_loop", &m_tree_listener_adsr1);
-
-//adsr2 listener
-m_value_tree.addParameterListener("env2_attack", &m_tree_listener_adsr2);
-m_value_tree.addParameterListener("env2_decay", &m_tree_listener_adsr2);
-m_value_tree.addParameterListener("env2_sustain", &m_tree_listener_adsr2);
-m_value_tree.addParameterListener("env2_release", &m_tree_listener_adsr2);
-m_value_tree.addParameterListener("env2_loop", &m_tree_listener_adsr2);
-
-//adsr3 listener
-m_value_tree.addParameterListener("env3_attack", &m_tree_listener_adsr3);
-m_value_tree.addParameterListener("env3_decay", &m_tree_listener_adsr3);
-m_value_tree.addParameterListener("env3_sustain", &m_tree_listener_adsr3);
-m_value_tree.addParameterListener("env3_release", &m_tree_listener_adsr3);
-m_value_tree.addParameterListener("env3_loop", &m_tree_listener_adsr3);
-
-//adsr4 listener
-m_value_tree.addParameterListener("env4_attack", &m_tree_listener_adsr4);
-m_value_tree.addParameterListener("env4_decay", &m_tree_listener_adsr4);
-m_value_tree.addParameterListener("env4_sustain", &m_tree_listener_adsr4);
-m_value_tree.addParameterListener("env4_release", &m_tree_listener_adsr4);
-m_value_tree.addParameterListener("env4_loop", &m_tree_listener_adsr4);
-
-//lfo1 listener
-m_value_tree.addParameterListener("lfo1_freq", &m_tree_listener_lfo1);
-m_value_tree.addParameterListener("lfo1_reset", &m_tree_listener_lfo1);
-
-//lfo2 listener
-m_value_tree.addParameterListener("lfo2_freq", &m_tree_listener_lfo2);
-m_value_tree.addParameterListener("lfo2_reset", &m_tree_listener_lfo2);
-
-//lfo3 listener
-m_value_tree.addParameterListener("lfo3_freq", &m_tree_listener_lfo3);
-m_value_tree.addParameterListener("lfo3_reset", &m_tree_listener_lfo3);
-
-//lfo4 listener
-m_value_tree.addParameterListener("lfo4_freq", &m_tree_listener_lfo4);
-m_value_tree.addParameterListener("lfo4_reset", &m_tree_listener_lfo4);
+//lfo 4 is global
+m_parameter_dispatcher.attach(m_value_tree, "lfo4_freq", [&](float p_value) { m_global_lfo.setBaseFrequency(p_value); });
+m_parameter_dispatcher.attach(m_value_tree, "lfo4_reset", [&](float p_value) {
+	m_global_lfo.setResetActive(p_value > 0.5f);
+});
 
 //general misc
-m_value_tree.addParameterListener("glide", &m_tree_listener_general_misc);
-m_value_tree.addParameterListener("master", &m_tree_listener_general_misc);
-
-m_value_tree.addParameterListener("unison_detune", &m_tree_listener_general_misc);
-m_value_tree.addParameterListener("unison_width", &m_tree_listener_general_misc);
-
-//arp listener
-m_value_tree.addParameterListener("step_0_on", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_1_on", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_2_on", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_3_on", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_4_on", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_5_on", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_6_on", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_7_on", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_8_on", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_9_on", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_10_on", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_11_on", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_12_on", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_13_on", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_14_on", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_15_on", &m_tree_listener_arp);
-
-m_value_tree.addParameterListener("step_0_mod_1", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_1_mod_1", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_2_mod_1", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_3_mod_1", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_4_mod_1", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_5_mod_1", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_6_mod_1", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_7_mod_1", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_8_mod_1", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_9_mod_1", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_10_mod_1", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_11_mod_1", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_12_mod_1", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_13_mod_1", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_14_mod_1", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_15_mod_1", &m_tree_listener_arp);
-
-m_value_tree.addParameterListener("step_0_mod_2", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_1_mod_2", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_2_mod_2", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_3_mod_2", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_4_mod_2", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_5_mod_2", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_6_mod_2", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_7_mod_2", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_8_mod_2", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_9_mod_2", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_10_mod_2", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_11_mod_2", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_12_mod_2", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_13_mod_2", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_14_mod_2", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_15_mod_2", &m_tree_listener_arp);
-
-m_value_tree.addParameterListener("step_0_transpose", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_1_transpose", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_2_transpose", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_3_transpose", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_4_transpose", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_5_transpose", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_6_transpose", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_7_transpose", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_8_transpose", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_9_transpose", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_10_transpose", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_11_transpose", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_12_transpose", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_13_transpose", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_14_transpose", &m_tree_listener_arp);
-m_value_tree.addParameterListener("step_15_transpose", &m_tree_listener_arp);
-
-m_value_tree.addParameterListener("arp_on", &m_tree_listener_arp);
-m_value_tree.addParameterListener("arp_one_shot", &m_tree_listener_arp);
\ No newline at end of file
+m_parameter_dispatcher.attach(m_value_tree, "glide", [&](float p_value) {
+	float glide_samplerate_adjusted = pow(p_value, 44800. / m_samplerate);
+	for (int voice = 0; voice < VOICES; ++voice) {
+		m_voice[voice].setGlide(glide_samplerate_adjusted);
+	}
+});
+m_parameter_dispatcher.attach(m_value_tree, "master", [&](float p_value) {
+	m_master_control = Decibels::decibelsToGain(p_value);
+});
+
+m_parameter_dispatcher.attach(m_value_tree, "unison_detune", [&](float p_value) {
+	for (int voice = 0; voice < VOICES; ++voice) {
+		m_voice[voice].setUnisonDetuneAmount(p_value);
+	}
+});
+m_parameter_dispatcher.attach(m_value_tree, "unison_width", [&](float p_value) {
+	for (int voice = 0; voice < VOICES; ++voice) {
+		m_voice[voice].setUnisonPanAmount(p_value);
+	}
+});
+
+//arp
+for (int step = 0; step < NUMBER_SEQUENCE_STEPS; ++step) {
+	const std::string step_prefix = "step_" + std::to_string(step);
+
+	m_parameter_dispatcher.attach(m_value_tree, step_prefix + "_on", [&, step](float p_value) {
+		m_arpeggiator.setSequenceStepActive(step, p_value > 0.5f);
+	});
+	m_parameter_dispatcher.attach(m_value_tree, step_prefix + "_mod_1", [&, step](float p_value) {
+		m_arpeggiator.setStepMod1(step, p_value);
+	});
+	m_parameter_dispatcher.attach(m_value_tree, step_prefix + "_mod_2", [&, step](float p_value) {
+		m_arpeggiator.setStepMod2(step, p_value);
+	});
+	m_parameter_dispatcher.attach(m_value_tree, step_prefix + "_transpose", [&, step](float p_value) {
+		m_arpeggiator.setStepTranspose(step, p_value);
+	});
+}
+
+m_parameter_dispatcher.attach(m_value_tree, "arp_on", [&](float p_value) {
+	m_arpeggiator.reset();
+	allNotesOff();
+	m_arpeggiator_on = p_value > 0.5f;
+	m_voice_manager.setSustainActive(false);
+	m_arpeggiator.setSustainActive(false);
+	m_step_led_active.set(-1);
+});
+m_parameter_dispatcher.attach(m_value_tree, "arp_one_shot", [&](float p_value) {
+	m_arpeggiator.setOneShotEnabled(p_value > 0.5f);
+});
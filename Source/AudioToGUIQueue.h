@@ -0,0 +1,51 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#pragma once
+
+#include "../JuceLibraryCode/JuceHeader.h"
+
+// single producer, single consumer queue which hands messages from the audio thread to the message thread.
+// the storage is preallocated, push() never locks or allocates and drops the message when the queue is full
+template <class Message, int SIZE>
+class AudioToGUIQueue {
+public:
+	bool push(const Message &p_message) {
+		int start_1, size_1, start_2, size_2;
+		m_fifo.prepareToWrite(1, start_1, size_1, start_2, size_2);
+		if (size_1 + size_2 == 0) {
+			return false;
+		}
+		m_messages[size_1 > 0 ? start_1 : start_2] = p_message;
+		m_fifo.finishedWrite(1);
+		return true;
+	}
+
+	bool pop(Message &p_message) {
+		int start_1, size_1, start_2, size_2;
+		m_fifo.prepareToRead(1, start_1, size_1, start_2, size_2);
+		if (size_1 + size_2 == 0) {
+			return false;
+		}
+		p_message = m_messages[size_1 > 0 ? start_1 : start_2];
+		m_fifo.finishedRead(1);
+		return true;
+	}
+
+private:
+	// the fifo holds at most SIZE - 1 messages
+	AbstractFifo m_fifo{SIZE};
+	Message m_messages[SIZE];
+};
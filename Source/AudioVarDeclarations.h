@@ -180,57 +180,9 @@
     Identifier m_osc1_type_identifier;
     Identifier m_osc2_type_identifier;
     Identifier m_osc3_type_identifier;
-    Identifier m_osc1_oct_identifier;
-    Identifier m_osc2_oct_identifier;
-    Identifier m_osc3_oct_identifier;
-    Identifier m_osc1_semi_identifier;
-    Identifier m_osc2_semi_identifier;
-    Identifier m_osc3_semi_identifier;
-    Identifier m_osc1_fine_identifier;
-    Identifier m_osc2_fine_identifier;
-    Identifier m_osc3_fine_identifier;
     Identifier m_osc1_analog_wave_identifier;
     Identifier m_osc2_analog_wave_identifier;
     Identifier m_osc3_analog_wave_identifier;
-    Identifier m_osc1_vol_identifier;
-    Identifier m_osc2_vol_identifier;
-    Identifier m_osc3_vol_identifier;
-    Identifier m_osc1_position_identifier;
-    Identifier m_osc2_position_identifier;
-    Identifier m_osc3_position_identifier;
-    Identifier m_osc1_detune_identifier;
-    Identifier m_osc2_detune_identifier;
-    Identifier m_osc3_detune_identifier;
-    Identifier m_osc1_pos_env_identifier;
-    Identifier m_osc2_pos_env_identifier;
-    Identifier m_osc3_pos_env_identifier;
-    Identifier m_osc1_multi_position_identifier;
-    Identifier m_osc2_multi_position_identifier;
-    Identifier m_osc3_multi_position_identifier;
-    Identifier m_osc1_spread_identifier;
-    Identifier m_osc2_spread_identifier;
-    Identifier m_osc3_spread_identifier;
-    Identifier m_osc1_pulsewidth_identifier;
-    Identifier m_osc2_pulsewidth_identifier;
-    Identifier m_osc3_pulsewidth_identifier;
-    Identifier m_osc1_drift_identifier;
-    Identifier m_osc2_drift_identifier;
-    Identifier m_osc3_drift_identifier;
-    Identifier m_osc1_arp_speed_identifier;
-    Identifier m_osc2_arp_speed_identifier;
-    Identifier m_osc3_arp_speed_identifier;
-    Identifier m_osc1_step_1_identifier;
-    Identifier m_osc2_step_1_identifier;
-    Identifier m_osc3_step_1_identifier;
-    Identifier m_osc1_step_2_identifier;
-    Identifier m_osc2_step_2_identifier;
-    Identifier m_osc3_step_2_identifier;
-    Identifier m_osc1_step_3_identifier;
-    Identifier m_osc2_step_3_identifier;
-    Identifier m_osc3_step_3_identifier;
-    Identifier m_osc1_fm_identifier;
-    Identifier m_osc2_fm_identifier;
-    Identifier m_osc3_fm_identifier;
     Identifier m_osc1_carrier_ratio_identifier;
     Identifier m_osc2_carrier_ratio_identifier;
     Identifier m_osc3_carrier_ratio_identifier;
@@ -246,32 +198,9 @@
     Identifier m_osc1_modulation_source_identifier;
     Identifier m_osc2_modulation_source_identifier;
     Identifier m_osc3_modulation_source_identifier;
-    Identifier m_osc1_lp_identifier;
-    Identifier m_osc2_lp_identifier;
-    Identifier m_osc3_lp_identifier;
-    Identifier m_osc1_hp_identifier;
-    Identifier m_osc2_hp_identifier;
-    Identifier m_osc3_hp_identifier;
-    Identifier m_osc1_reset_identifier;
-    Identifier m_osc2_reset_identifier;
-    Identifier m_osc3_reset_identifier;
-    Identifier m_osc2_sync_identifier;
-    Identifier m_osc3_sync_identifier;
-    Identifier m_osc1_arp_on_identifier;
-    Identifier m_osc2_arp_on_identifier;
-    Identifier m_osc3_arp_on_identifier;
-    Identifier m_osc1_step_3_on_identifier;
-    Identifier m_osc2_step_3_on_identifier;
-    Identifier m_osc3_step_3_on_identifier;
-    Identifier m_osc1_chipnoise_identifier;
-    Identifier m_osc2_chipnoise_identifier;
-    Identifier m_osc3_chipnoise_identifier;
     Identifier m_osc1_chipwave_identifier;
     Identifier m_osc2_chipwave_identifier;
     Identifier m_osc3_chipwave_identifier;
-    Identifier m_osc1_exp_fm_identifier;
-    Identifier m_osc2_exp_fm_identifier;
-    Identifier m_osc3_exp_fm_identifier;
     Identifier m_osc1_vec_a_identifier;
     Identifier m_osc2_vec_a_identifier;
     Identifier m_osc3_vec_a_identifier;
@@ -284,48 +213,12 @@
     Identifier m_osc1_vec_d_identifier;
     Identifier m_osc2_vec_d_identifier;
     Identifier m_osc3_vec_d_identifier;
-    Identifier m_osc1_vec_x_identifier;
-    Identifier m_osc2_vec_x_identifier;
-    Identifier m_osc3_vec_x_identifier;
-    Identifier m_osc1_vec_y_identifier;
-    Identifier m_osc2_vec_y_identifier;
-    Identifier m_osc3_vec_y_identifier;
     Identifier m_osc1_wavetable_identifier;
     Identifier m_osc2_wavetable_identifier;
     Identifier m_osc3_wavetable_identifier;
     Identifier m_fil1_type_identifier;
     Identifier m_fil2_type_identifier;
     Identifier m_fil3_type_identifier;
-    Identifier m_fil1_vel_identifier;
-    Identifier m_fil2_vel_identifier;
-    Identifier m_fil3_vel_identifier;
-    Identifier m_fil1_env_identifier;
-    Identifier m_fil2_env_identifier;
-    Identifier m_fil3_env_identifier;
-    Identifier m_fil1_kbd_identifier;
-    Identifier m_fil2_kbd_identifier;
-    Identifier m_fil3_kbd_identifier;
-    Identifier m_fil1_gain_identifier;
-    Identifier m_fil2_gain_identifier;
-    Identifier m_fil3_gain_identifier;
-    Identifier m_fil1_freq_identifier;
-    Identifier m_fil2_freq_identifier;
-    Identifier m_fil3_freq_identifier;
-    Identifier m_fil1_res_identifier;
-    Identifier m_fil2_res_identifier;
-    Identifier m_fil3_res_identifier;
-    Identifier m_fil1_saturation_identifier;
-    Identifier m_fil2_saturation_identifier;
-    Identifier m_fil3_saturation_identifier;
-    Identifier m_fil1_formant_transition_identifier;
-    Identifier m_fil2_formant_transition_identifier;
-    Identifier m_fil3_formant_transition_identifier;
-    Identifier m_fil1_ring_mod_amount_identifier;
-    Identifier m_fil2_ring_mod_amount_identifier;
-    Identifier m_fil3_ring_mod_amount_identifier;
-    Identifier m_fil1_sem_transition_identifier;
-    Identifier m_fil2_sem_transition_identifier;
-    Identifier m_fil3_sem_transition_identifier;
     Identifier m_fil1_vowel_left_identifier;
     Identifier m_fil2_vowel_left_identifier;
     Identifier m_fil3_vowel_left_identifier;
@@ -335,71 +228,33 @@
     Identifier m_fil1_comb_polarity_identifier;
     Identifier m_fil2_comb_polarity_identifier;
     Identifier m_fil3_comb_polarity_identifier;
-    Identifier m_amp_pan_identifier;
-    Identifier m_amp_gain_identifier;
-    Identifier m_amp_velocity_identifier;
-    Identifier m_dist_threshold_identifier;
-    Identifier m_dist_drywet_identifier;
     Identifier m_dist_on_identifier;
     Identifier m_dist_algo_identifier;
     Identifier m_fil1_to_amp_identifier;
     Identifier m_fil2_to_amp_identifier;
-    Identifier m_env1_attack_identifier;
-    Identifier m_env1_decay_identifier;
-    Identifier m_env1_sustain_identifier;
-    Identifier m_env1_release_identifier;
-    Identifier m_env1_loop_identifier;
-    Identifier m_env2_attack_identifier;
-    Identifier m_env2_decay_identifier;
-    Identifier m_env2_sustain_identifier;
-    Identifier m_env2_release_identifier;
-    Identifier m_env2_loop_identifier;
-    Identifier m_env3_attack_identifier;
-    Identifier m_env3_decay_identifier;
-    Identifier m_env3_sustain_identifier;
-    Identifier m_env3_release_identifier;
-    Identifier m_env3_loop_identifier;
-    Identifier m_env4_attack_identifier;
-    Identifier m_env4_decay_identifier;
-    Identifier m_env4_sustain_identifier;
-    Identifier m_env4_release_identifier;
-    Identifier m_env4_loop_identifier;
-    Identifier m_lfo1_freq_identifier;
-    Identifier m_lfo1_reset_identifier;
     Identifier m_lfo1_sync_identifier;
     Identifier m_lfo1_wave_identifier;
     Identifier m_lfo1_synctime_numerator_identifier;
     Identifier m_lfo1_synctime_denominator_identifier;
-    Identifier m_lfo2_freq_identifier;
-    Identifier m_lfo2_reset_identifier;
     Identifier m_lfo2_sync_identifier;
     Identifier m_lfo2_wave_identifier;
     Identifier m_lfo2_synctime_numerator_identifier;
     Identifier m_lfo2_synctime_denominator_identifier;
-    Identifier m_lfo3_freq_identifier;
-    Identifier m_lfo3_reset_identifier;
     Identifier m_lfo3_sync_identifier;
     Identifier m_lfo3_wave_identifier;
     Identifier m_lfo3_synctime_numerator_identifier;
     Identifier m_lfo3_synctime_denominator_identifier;
-    Identifier m_lfo4_freq_identifier;
-    Identifier m_lfo4_reset_identifier;
     Identifier m_lfo4_sync_identifier;
     Identifier m_lfo4_wave_identifier;
     Identifier m_lfo4_synctime_numerator_identifier;
     Identifier m_lfo4_synctime_denominator_identifier;
-    Identifier m_glide_identifier;
-    Identifier m_master_identifier;
     Identifier m_modwheel_identifier;
     Identifier m_pitchbend_identifier;
     Identifier m_pitchbend_amount_identifier;
     Identifier m_unison_voices_identifier;
-    Identifier m_unison_width_identifier;
-    Identifier m_unison_detune_identifier;
     Identifier m_xy_x_identifier;
     Identifier m_xy_y_identifier;
     Identifier m_legato_identifier;
-    Identifier m_delay_on_identifier;
     Identifier m_phaser_on_identifier;
     Identifier m_flanger_on_identifier;
     Identifier m_chorus_on_identifier;
@@ -415,123 +270,30 @@
     Identifier m_phaser_position_identifier;
     Identifier m_chorus_position_identifier;
     Identifier m_reverb_position_identifier;
-    Identifier m_delay_time_identifier;
-    Identifier m_delay_feedback_identifier;
-    Identifier m_delay_hp_identifier;
-    Identifier m_delay_ducking_identifier;
-    Identifier m_delay_dry_identifier;
-    Identifier m_delay_wet_identifier;
     Identifier m_delay_sync_identifier;
-    Identifier m_delay_pingpong_identifier;
     Identifier m_delay_synctime_numerator_identifier;
     Identifier m_delay_synctime_denominator_identifier;
-    Identifier m_reverb_delay_identifier;
-    Identifier m_reverb_eq_gain_identifier;
-    Identifier m_reverb_eq_freq_identifier;
     //Identifier m_reverb_ducking_identifier;
-    Identifier m_reverb_mid_hall_identifier;
-    Identifier m_reverb_on_identifier;
-    Identifier m_reverb_hf_damp_identifier;
-    Identifier m_reverb_dry_wet_identifier;
     Identifier m_phaser_reset_identifier;
-    Identifier m_arp_on_identifier;
-    Identifier m_arp_one_shot_identifier;
     Identifier m_arp_synctime_denominator_identifier;
     Identifier m_arp_synctime_numerator_identifier;
     Identifier m_arp_octaves_identifier;
     Identifier m_arp_direction_identifier;
     Identifier m_arp_steps_identifier;
     Identifier m_arp_gate_identifier;
-    Identifier m_step_0_on_identifier;
-    Identifier m_step_1_on_identifier;
-    Identifier m_step_2_on_identifier;
-    Identifier m_step_3_on_identifier;
-    Identifier m_step_4_on_identifier;
-    Identifier m_step_5_on_identifier;
-    Identifier m_step_6_on_identifier;
-    Identifier m_step_7_on_identifier;
-    Identifier m_step_8_on_identifier;
-    Identifier m_step_9_on_identifier;
-    Identifier m_step_10_on_identifier;
-    Identifier m_step_11_on_identifier;
-    Identifier m_step_12_on_identifier;
-    Identifier m_step_13_on_identifier;
-    Identifier m_step_14_on_identifier;
-    Identifier m_step_15_on_identifier;
 
-    Identifier m_step_0_mod_1_identifier;
-    Identifier m_step_1_mod_1_identifier;
-    Identifier m_step_2_mod_1_identifier;
-    Identifier m_step_3_mod_1_identifier;
-    Identifier m_step_4_mod_1_identifier;
-    Identifier m_step_5_mod_1_identifier;
-    Identifier m_step_6_mod_1_identifier;
-    Identifier m_step_7_mod_1_identifier;
-    Identifier m_step_8_mod_1_identifier;
-    Identifier m_step_9_mod_1_identifier;
-    Identifier m_step_10_mod_1_identifier;
-    Identifier m_step_11_mod_1_identifier;
-    Identifier m_step_12_mod_1_identifier;
-    Identifier m_step_13_mod_1_identifier;
-    Identifier m_step_14_mod_1_identifier;
-    Identifier m_step_15_mod_1_identifier;
 
-    Identifier m_step_0_mod_2_identifier;
-    Identifier m_step_1_mod_2_identifier;
-    Identifier m_step_2_mod_2_identifier;
-    Identifier m_step_3_mod_2_identifier;
-    Identifier m_step_4_mod_2_identifier;
-    Identifier m_step_5_mod_2_identifier;
-    Identifier m_step_6_mod_2_identifier;
-    Identifier m_step_7_mod_2_identifier;
-    Identifier m_step_8_mod_2_identifier;
-    Identifier m_step_9_mod_2_identifier;
-    Identifier m_step_10_mod_2_identifier;
-    Identifier m_step_11_mod_2_identifier;
-    Identifier m_step_12_mod_2_identifier;
-    Identifier m_step_13_mod_2_identifier;
-    Identifier m_step_14_mod_2_identifier;
-    Identifier m_step_15_mod_2_identifier;
 
-    Identifier m_step_0_transpose_identifier;
-    Identifier m_step_1_transpose_identifier;
-    Identifier m_step_2_transpose_identifier;
-    Identifier m_step_3_transpose_identifier;
-    Identifier m_step_4_transpose_identifier;
-    Identifier m_step_5_transpose_identifier;
-    Identifier m_step_6_transpose_identifier;
-    Identifier m_step_7_transpose_identifier;
-    Identifier m_step_8_transpose_identifier;
-    Identifier m_step_9_transpose_identifier;
-    Identifier m_step_10_transpose_identifier;
-    Identifier m_step_11_transpose_identifier;
-    Identifier m_step_12_transpose_identifier;
-    Identifier m_step_13_transpose_identifier;
-    Identifier m_step_14_transpose_identifier;
-    Identifier m_step_15_transpose_identifier;
 
     Identifier m_phaser_sync_identifier;
-    Identifier m_phaser_rate_identifier;
-    Identifier m_phaser_freq_identifier;
-    Identifier m_phaser_feedback_identifier;
-    Identifier m_phaser_mod_identifier;
-    Identifier m_phaser_drywet_identifier;
     Identifier m_phaser_synctime_numerator_identifier;
     Identifier m_phaser_synctime_denominator_identifier;
     Identifier m_flanger_reset_identifier;
     Identifier m_flanger_sync_identifier;
-    Identifier m_flanger_rate_identifier;
-    Identifier m_flanger_amount_identifier;
-    Identifier m_flanger_feedback_identifier;
-    Identifier m_flanger_drywet_identifier;
     Identifier m_flanger_synctime_numerator_identifier;
     Identifier m_flanger_synctime_denominator_identifier;
     Identifier m_chorus_reset_identifier;
     Identifier m_chorus_sync_identifier;
-    Identifier m_chorus_rate_identifier;
-    Identifier m_chorus_amount_identifier;
-    Identifier m_chorus_drywet_identifier;
-    Identifier m_chorus_feedback_identifier;
     Identifier m_chorus_synctime_numerator_identifier;
     Identifier m_chorus_synctime_denominator_identifier;
     Identifier m_amount_1_row_1_identifier;
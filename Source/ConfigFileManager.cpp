@@ -62,6 +62,22 @@ void ConfigFileManager::loadDataFromFile() {
 						DBG("Found Config Element: " << XML_ATTRIBUTE_PATCH_DIR << ": "
 						                             << child->getStringAttribute("data"));
 						m_patch_dir = child->getStringAttribute("data");
+					} else if (child->hasTagName(XML_ATTRIBUTE_VOICE_THREADS)) {
+						DBG("Found Config Element: " << XML_ATTRIBUTE_VOICE_THREADS << ": "
+						                             << child->getIntAttribute("data"));
+						m_voice_threads = child->getIntAttribute("data");
+					} else if (child->hasTagName(XML_ATTRIBUTE_CONTROL_RATE)) {
+						DBG("Found Config Element: " << XML_ATTRIBUTE_CONTROL_RATE << ": "
+						                             << child->getIntAttribute("data"));
+						m_control_rate = child->getIntAttribute("data");
+					} else if (child->hasTagName(XML_ATTRIBUTE_OVERSAMPLING)) {
+						DBG("Found Config Element: " << XML_ATTRIBUTE_OVERSAMPLING << ": "
+						                             << child->getIntAttribute("data"));
+						m_oversampling = child->getIntAttribute("data");
+					} else if (child->hasTagName(XML_ATTRIBUTE_OVERSAMPLING_QUALITY)) {
+						DBG("Found Config Element: " << XML_ATTRIBUTE_OVERSAMPLING_QUALITY << ": "
+						                             << child->getIntAttribute("data"));
+						m_oversampling_quality = child->getIntAttribute("data");
 					}
 				}
 			}
@@ -92,6 +108,22 @@ void ConfigFileManager::saveDataToFile() {
 	patch_dir->setAttribute("data", m_patch_dir);
 	config_xml->addChildElement(patch_dir);
 
+	XmlElement *voice_threads = new XmlElement(XML_ATTRIBUTE_VOICE_THREADS);
+	voice_threads->setAttribute("data", m_voice_threads);
+	config_xml->addChildElement(voice_threads);
+
+	XmlElement *control_rate = new XmlElement(XML_ATTRIBUTE_CONTROL_RATE);
+	control_rate->setAttribute("data", m_control_rate);
+	config_xml->addChildElement(control_rate);
+
+	XmlElement *oversampling = new XmlElement(XML_ATTRIBUTE_OVERSAMPLING);
+	oversampling->setAttribute("data", m_oversampling);
+	config_xml->addChildElement(oversampling);
+
+	XmlElement *oversampling_quality = new XmlElement(XML_ATTRIBUTE_OVERSAMPLING_QUALITY);
+	oversampling_quality->setAttribute("data", m_oversampling_quality);
+	config_xml->addChildElement(oversampling_quality);
+
 	//DBG_VAR(config_xml->toString());
 
 	String path_absolute    = CONFIG_FILE_PATH;
@@ -135,3 +167,35 @@ void ConfigFileManager::setOptionPatchDir(String p_dir) {
 String ConfigFileManager::getOptionPatchDir() {
 	return m_patch_dir;
 }
+
+void ConfigFileManager::setOptionVoiceThreads(int p_threads) {
+	m_voice_threads = p_threads;
+}
+
+int ConfigFileManager::getOptionVoiceThreads() {
+	return m_voice_threads;
+}
+
+void ConfigFileManager::setOptionControlRate(int p_samples) {
+	m_control_rate = p_samples;
+}
+
+int ConfigFileManager::getOptionControlRate() {
+	return m_control_rate;
+}
+
+void ConfigFileManager::setOptionOversampling(int p_factor) {
+	m_oversampling = p_factor;
+}
+
+int ConfigFileManager::getOptionOversampling() {
+	return m_oversampling;
+}
+
+void ConfigFileManager::setOptionOversamplingQuality(int p_quality) {
+	m_oversampling_quality = p_quality;
+}
+
+int ConfigFileManager::getOptionOversamplingQuality() {
+	return m_oversampling_quality;
+}
@@ -28,6 +28,10 @@
 #define XML_ATTRIBUTE_TUNING_DIR ("tuning_dir")
 #define XML_ATTRIBUTE_SOUNDBANK_DIR ("soundbank_dir")
 #define XML_ATTRIBUTE_PATCH_DIR ("patch_dir")
+#define XML_ATTRIBUTE_VOICE_THREADS ("voice_threads")
+#define XML_ATTRIBUTE_CONTROL_RATE ("control_rate")
+#define XML_ATTRIBUTE_OVERSAMPLING ("oversampling")
+#define XML_ATTRIBUTE_OVERSAMPLING_QUALITY ("oversampling_quality")
 
 /**
  * This class manages the config file. Data is loaded from the file in constructor if possible. Then the individual 
@@ -46,6 +50,14 @@ public:
 	String getOptionSoundbankDir();
 	void setOptionPatchDir(String p_dir);
 	String getOptionPatchDir();
+	void setOptionVoiceThreads(int p_threads);
+	int getOptionVoiceThreads();
+	void setOptionControlRate(int p_samples);
+	int getOptionControlRate();
+	void setOptionOversampling(int p_factor);
+	int getOptionOversampling();
+	void setOptionOversamplingQuality(int p_quality);
+	int getOptionOversamplingQuality();
 
 private:
 	void createDirIfNeeded();
@@ -55,4 +67,8 @@ private:
 	String m_tuning_dir = DEFAULT_TUNING_DIRECTORY;
 	String m_soundbank_dir = DEFAULT_SOUNDBANK_IO_LOCATION_STRING;
 	String m_patch_dir = DEFAULT_PATCH_LOCATION_STRING;
+	int m_voice_threads = 0; // additional threads rendering voices, 0 renders everything on the audio thread
+	int m_control_rate = SUB_BLOCK_SIZE; // samples per modmatrix update, 1 - SUB_BLOCK_SIZE
+	int m_oversampling = 4; // voice distortion and synced oscs, 2, 4 or 8
+	int m_oversampling_quality = 0; // 0 low, 1 high
 };
@@ -69,6 +69,9 @@
 #define DARKGREY juce::Colour(30, 30, 30)
 #define CHORUS_DISPLAY_COLOR Colour(69, 39, 38)
 #define VOICES 24
+#define SUB_BLOCK_SIZE 32 // max samples per control-rate sub-block in processBlock()
+#define AUDIO_TO_GUI_QUEUE_SIZE 64
+#define AUDIO_TO_GUI_INTERVAL_MS 30
 
 #define MATRIX_SECTION_INDEX_PRESETS 10
 #define MATRIX_SECTION_INDEX_ARP 1
@@ -93,6 +96,7 @@
 #endif
 //#endif
 #define CONFIG_FILE_PATH ODIN_STORAGE_PATH + File::getSeparatorString() + "odin2.conf"
+#define WAVETABLE_CACHE_PATH ODIN_STORAGE_PATH + File::getSeparatorString() + "WavetableCache"
 
 // leave spare values for future additions :hype:
 #define OSC_TYPE_ANALOG 2
@@ -0,0 +1,122 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#pragma once
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include <atomic>
+
+// Accumulates the time processBlock() spends in each module. Only compiled into the audio code when ODIN_PROFILING
+// is defined (cmake -DODIN2_PROFILING=ON), otherwise ODIN_PROFILE_SCOPE() expands to nothing.
+// The counters only ever grow and are lock-free, so voice worker threads can add to them as well. Readers take two
+// snapshots and look at the difference, see ProfilerComponent and the benchmark.
+class ModuleProfiler {
+public:
+	enum Module {
+		MidiAndArp = 0,
+		Modulators,
+		ModMatrix,
+		Oscillators,
+		Filters,
+		Amplifier,
+		Distortion,
+		Filter3,
+		Delay,
+		Phaser,
+		Flanger,
+		Chorus,
+		Reverb,
+		Output,
+		NumberOfModules
+	};
+
+	struct Snapshot {
+		int64 ticks[NumberOfModules] = {0};
+		int64 samples                = 0;
+
+		// time spent in the module in percent of the audio time rendered, summed over all threads
+		double getPercent(int p_module, const Snapshot &p_previous, double p_samplerate) const {
+			const int64 samples = this->samples - p_previous.samples;
+			if (samples <= 0 || p_samplerate <= 0) {
+				return 0.;
+			}
+			const double seconds = Time::highResolutionTicksToSeconds(ticks[p_module] - p_previous.ticks[p_module]);
+			return 100. * seconds * p_samplerate / (double)samples;
+		}
+	};
+
+	static const char *getModuleName(int p_module) {
+		static const char *names[NumberOfModules] = {"midi & arp",
+		                                             "modulators",
+		                                             "modmatrix",
+		                                             "oscillators",
+		                                             "filters",
+		                                             "amplifier",
+		                                             "distortion",
+		                                             "filter 3",
+		                                             "delay",
+		                                             "phaser",
+		                                             "flanger",
+		                                             "chorus",
+		                                             "reverb",
+		                                             "output"};
+		return names[p_module];
+	}
+
+	void addTicks(int p_module, int64 p_ticks) {
+		m_ticks[p_module].fetch_add(p_ticks, std::memory_order_relaxed);
+	}
+
+	// called at the end of each processBlock()
+	void addSamples(int p_num_samples) {
+		m_samples.fetch_add(p_num_samples, std::memory_order_relaxed);
+	}
+
+	Snapshot getSnapshot() const {
+		Snapshot snapshot;
+		for (int module = 0; module < NumberOfModules; ++module) {
+			snapshot.ticks[module] = m_ticks[module].load(std::memory_order_relaxed);
+		}
+		snapshot.samples = m_samples.load(std::memory_order_relaxed);
+		return snapshot;
+	}
+
+private:
+	std::atomic<int64> m_ticks[NumberOfModules] = {};
+	std::atomic<int64> m_samples                = {0};
+};
+
+// adds the time until the end of the scope to one module
+class ScopedModuleTimer {
+public:
+	ScopedModuleTimer(ModuleProfiler &p_profiler, int p_module) :
+	    m_profiler(p_profiler), m_module(p_module), m_start(Time::getHighResolutionTicks()) {
+	}
+	~ScopedModuleTimer() {
+		m_profiler.addTicks(m_module, Time::getHighResolutionTicks() - m_start);
+	}
+
+private:
+	ModuleProfiler &m_profiler;
+	const int m_module;
+	const int64 m_start;
+};
+
+#ifdef ODIN_PROFILING
+#define ODIN_PROFILE_SCOPE(module)                                                                                     \
+	ScopedModuleTimer JUCE_JOIN_MACRO(profile_scope_, __LINE__)(m_profiler, ModuleProfiler::module)
+#else
+#define ODIN_PROFILE_SCOPE(module)
+#endif
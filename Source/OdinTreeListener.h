@@ -15,16 +15,111 @@
 
 #include "../JuceLibraryCode/JuceHeader.h"
 
+#include <atomic>
 #include <functional>
+#include <memory>
+#include <vector>
 #pragma once
 
-class OdinTreeListener : public AudioProcessorValueTreeState::Listener {
+#define PARAMETER_DISPATCHER_MAX_PARAMETERS 512 // power of two
+
+// Indices of the parameters which changed since the last OdinParameterDispatcher::applyChanges(). Any thread may
+// push, only the audio thread pops. A parameter is pushed at most once until it was popped, so the ring can't
+// overflow as long as it has a slot for every parameter
+class OdinParameterChangeList {
+public:
+	OdinParameterChangeList() {
+		for (auto &slot : m_slots) {
+			slot.store(-1, std::memory_order_relaxed);
+		}
+	}
+
+	void push(int p_index) {
+		const unsigned int write = m_write.fetch_add(1, std::memory_order_relaxed);
+		m_slots[write & (PARAMETER_DISPATCHER_MAX_PARAMETERS - 1)].store(p_index, std::memory_order_release);
+	}
+
+	// stops at a slot which was claimed by push() but not yet written, it is picked up next time
+	bool pop(int &p_index) {
+		std::atomic<int> &slot = m_slots[m_read & (PARAMETER_DISPATCHER_MAX_PARAMETERS - 1)];
+		p_index                = slot.load(std::memory_order_acquire);
+		if (p_index < 0) {
+			return false;
+		}
+		slot.store(-1, std::memory_order_relaxed);
+		++m_read;
+		return true;
+	}
+
+private:
+	std::atomic<int> m_slots[PARAMETER_DISPATCHER_MAX_PARAMETERS];
+	std::atomic<unsigned int> m_write{0};
+	unsigned int m_read = 0;
+};
+
+// Listens to a single parameter. A change only stores the value and queues the parameter, applyChanges() hands the
+// latest value to the handler later on
+class OdinParameterListener : public AudioProcessorValueTreeState::Listener {
+public:
+	OdinParameterListener(std::function<void(float)> p_handler, int p_index, OdinParameterChangeList &p_changes) :
+	    m_handler(std::move(p_handler)), m_index(p_index), m_changes(p_changes) {
+	}
+
+	void parameterChanged(const String &, float newValue) override {
+		m_value.store(newValue, std::memory_order_relaxed);
+		if (!m_queued.exchange(true, std::memory_order_acq_rel)) {
+			m_changes.push(m_index);
+		}
+	}
+
+	// after it was popped from the change list. A change from now on queues the parameter again
+	void apply() {
+		m_queued.exchange(false, std::memory_order_acq_rel);
+		m_handler(m_value.load(std::memory_order_relaxed));
+	}
+
+private:
+	const std::function<void(float)> m_handler;
+	const int m_index;
+	OdinParameterChangeList &m_changes;
+	std::atomic<float> m_value{0.f};
+	std::atomic<bool> m_queued{false};
+};
+
+// Collects the parameter changes from the host and the GUI and applies them on the audio thread at the start of a
+// block. Several changes of a parameter in between only call its handler once, with the latest value
+class OdinParameterDispatcher {
 public:
-	std::function<void(const String &, float)> onValueChange;
+	// changes of p_ID go to p_handler, which is bound to its osc, filter etc. here instead of looking up the ID later
+	void attach(AudioProcessorValueTreeState &p_tree, const String &p_ID, std::function<void(float)> p_handler) {
+		jassert(m_listeners.size() < PARAMETER_DISPATCHER_MAX_PARAMETERS);
+		m_listeners.emplace_back(new OdinParameterListener(std::move(p_handler), (int)m_listeners.size(), m_changes));
+		p_tree.addParameterListener(p_ID, m_listeners.back().get());
+	}
+
+	// only visits the parameters which changed
+	void applyChanges() {
+		if (m_held.load(std::memory_order_acquire)) {
+			return;
+		}
+		int index;
+		while (m_changes.pop(index)) {
+			m_listeners[index]->apply();
+		}
+	}
 
-	void parameterChanged(const String &parameterID, float newValue) override {
-		onValueChange(parameterID, newValue);
+	// while held the changes are only collected, so a patch reaches the audio thread in one go after release()
+	void hold() {
+		m_held.store(true, std::memory_order_release);
+	}
+	void release() {
+		m_held.store(false, std::memory_order_release);
 	}
+
+private:
+	std::vector<std::unique_ptr<OdinParameterListener>> m_listeners;
+	OdinParameterChangeList m_changes;
+	std::atomic<bool> m_held{false};
 };
 
 class OdinTreeListenerNonParam : public ValueTree::Listener {
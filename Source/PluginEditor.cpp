@@ -633,6 +633,12 @@ OdinAudioProcessorEditor::OdinAudioProcessorEditor(OdinAudioProcessor &p_process
 	setTooltipEnabled(false);
 	addAndMakeVisible(m_tooltip);
 
+#ifdef ODIN_PROFILING
+	m_profiler_component.setTopLeftPosition(0, 0);
+	m_profiler_component.setAlwaysOnTop(true);
+	addAndMakeVisible(m_profiler_component);
+#endif
+
 	forceValueTreeOntoComponents(false);
 
 	bool set_GUI_big;
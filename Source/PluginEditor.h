@@ -41,6 +41,7 @@
 #include "gui/PatchBrowser.h"
 #include "gui/PhaserComponent.h"
 #include "gui/PitchWheel.h"
+#include "gui/ProfilerComponent.h"
 #include "gui/ReverbComponent.h"
 #include "gui/TuningComponent.h"
 #include "gui/XYSectionComponent.h"
@@ -413,6 +414,11 @@ private:
 
 	OdinAudioProcessor &m_processor;
 
+#ifdef ODIN_PROFILING
+	// declared after m_processor, which it is constructed from
+	ProfilerComponent m_profiler_component{m_processor};
+#endif
+
 	juce::Image m_odin_backdrop;
 
 	void setOsc1Plate(int p_osc_type);
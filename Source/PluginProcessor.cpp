@@ -13,6 +13,7 @@
 ** GNU General Public License for more details.
 */
 
+#include "ConfigFileManager.h"
 #include "PluginEditor.h"
 #include "PluginProcessor.h"
 
@@ -25,4 +26,5 @@
 #include "PluginProcessorMidi.cpp"
 #include "PluginProcessorProcess.cpp"
 #include "PluginProcessorConstructor.cpp"
-#include "PluginProcessorMisc.cpp"
\ No newline at end of file
+#include "PluginProcessorMisc.cpp"
+#include "PluginProcessorState.cpp"
\ No newline at end of file
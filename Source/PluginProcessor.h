@@ -16,7 +16,9 @@
 #pragma once
 
 #include "../JuceLibraryCode/JuceHeader.h"
+#include "AudioToGUIQueue.h"
 #include "GlobalIncludes.h"
+#include "ModuleProfiler.h"
 #include "OdinTreeListener.h"
 #include "audio/FX/Chorus.h"
 #include "audio/FX/Delay.h"
@@ -30,7 +32,12 @@
 #include "audio/Filters/Korg35Filter.h"
 #include "audio/Filters/LadderFilter.h"
 #include "audio/Filters/SEMFilter12.h"
+#include "audio/NoteFrequencyTable.h"
+#include "audio/PatchFader.h"
+#include "audio/SilenceDetector.h"
+#include "audio/VoiceWorkerPool.h"
 #include "audio/Oscillators/WavetableContainer.h"
+#include "audio/Oscillators/WavetableOscBank.h"
 #include "audio/Voice.h"
 #include "gui/DrawableSlider.h"
 #include "gui/OdinKnob.h"
@@ -43,7 +50,7 @@
 
 class OdinAudioProcessorEditor;
 
-class OdinAudioProcessor : public AudioProcessor {
+class OdinAudioProcessor : public AudioProcessor, private Timer {
 public:
 
 	OdinAudioProcessor();
@@ -94,6 +101,14 @@ public:
 	void attachNonParamListeners();
 	void migratePatch(ValueTree &p_patch);
 	void readPatch(const ValueTree &newState);
+	// additional threads which render voices, applied in the next prepareToPlay()
+	void setVoiceThreads(int p_threads);
+	// samples per sub-block in which the modmatrix runs, ramped destinations are interpolated in between
+	void setControlRate(int p_samples);
+	// oversampling of the voice distortion and of synced oscs, applied in the next prepareToPlay()
+	void setOversampling(int p_factor, Oversampler::Quality p_quality);
+	// fade out and in around patch changes, 0 switches without a fade
+	void setPatchFadeTime(float p_milliseconds);
 
 	std::function<void()> onSetStateInformation    = []() {};
 	std::function<void(float)> updatePitchWheelGUI = [](float p_value) {};
@@ -102,11 +117,15 @@ public:
 	// this is used to retrigger a held down note if the note after it was released. It stores note and velocity
 	std::list<std::pair<int, int>> m_playmode_mono_note_list;
 	Atomic<int> m_step_led_active = -1;
+	// time spent per module, only filled when built with ODIN_PROFILING
+	ModuleProfiler m_profiler;
+	// only read here, changes go through setTuning()
 	Tunings::Tuning m_tuning;
+	// also rebuilds the note frequencies of the voices
+	void setTuning(const Tunings::Tuning &p_tuning);
 
 private:
 	void setSampleRate(float p_samplerate);
-	void setFilter3EnvValue();
 	void setBPM(float BPM);
 	void setPitchWheelValue(int p_value);
 	void setModWheelValue(int p_value);
@@ -115,81 +134,65 @@ private:
 	void addNonAudioParametersToTree();
 	void handleMidiMessage(const MidiMessage &p_midi_message);
 	void createDrawTablesFromValueTree();
+	// decode the host state into a tree for readPatch(), see PluginProcessorState.cpp
+	ValueTree readBinaryState(const void *p_data, int p_size, String &p_scl, String &p_kbm);
+	ValueTree readXmlState(const void *p_data, int p_size, String &p_scl, String &p_kbm);
 	bool checkLoadParameter(const String &p_name);
+	// sets everything which differs from the current state, called by readPatch(). The audio engine keeps the old
+	// patch until handOverPatch()
+	void applyPatch(const ValueTree &newStateMigrated);
+	// passes the pending patch to the audio engine, only this holds the callback lock
+	void handOverPatch();
+	void checkPatchFade();
+	// sets the properties of p_patch_tree which differ, returns whether any did
+	bool applyPatchProperties(ValueTree &p_tree, const ValueTree &p_patch_tree, bool p_notify_all);
 	void writeDefaultWavedrawValuesToTree(int p_osc);
 	void writeDefaultChipdrawValuesToTree(int p_osc);
 	void writeDefaultSpecdrawValuesToTree(int p_osc);
 	void initializeModules();
+	void loadOscillatorWavetables();
+	// the part of the setup which is deferred from the constructor, so creating an instance stays quick. Called by
+	// prepareToPlay(), does nothing if the oscs already have the tables for p_samplerate
+	void prepareWavetables(double p_samplerate);
+	void timerCallback() override;
+	// reports the delay of the distortion oversampling while the distortion is on
+	void updateLatency();
+
+	// sub-block rendering, see PluginProcessorProcess.cpp
+	int fireArpeggiatorEvents(int p_window_start, int p_sample, int p_event_index, int p_num_events);
+	void renderSmoothing(int p_num_samples);
+	void renderVoiceModulators(int p_voice, int p_num_samples);
+	void renderOscillators(int p_num_samples);
+	void renderOscillatorBanks(int p_num_samples);
+	template <class GetOsc>
+	void renderOscillatorBank(int p_osc, int p_num_samples, GetOsc p_get_osc);
+	void renderVoice(int p_voice, int p_num_samples);
+	static void renderVoiceJob(void *p_processor, int p_index);
+	void renderOscillator(int p_voice, int p_osc, int p_start, int p_end);
+	float oscillateWithSync(WavetableOsc1D &p_osc, int p_voice, int p_osc_index, int p_sample);
+	WavetableOsc1D *getSyncedOscillator(int p_voice, int p_osc);
+	void renderFilter(int p_voice, int p_fil, int p_num_samples);
+	void renderFilter3(int p_num_samples);
+	void renderFX(int p_num_samples);
+	// nothing is playing and every enabled stage after the voices is asleep, so the block is silent
+	bool isSleeping() const;
+	void rampModulation(const float *p_destination, int p_num_samples, float *p_ramp) const;
+	float applyVolumeModulation(float p_volume, float p_mod);
 
 	void treeValueChangedNonParamFX(ValueTree &tree, const Identifier &identifier);
 	void treeValueChangedNonParamLFO(ValueTree &tree, const Identifier &identifier);
 	void treeValueChangedNonParamMisc(ValueTree &tree, const Identifier &identifier);
 	void treeValueChangedNonParamMod(ValueTree &tree, const Identifier &identifier);
 	void treeValueChangedNonParamOsc(ValueTree &tree, const Identifier &identifier);
-
-	void treeValueChangedOscPitch(const String &p_ID, float p_new_value);
-	void treeValueChangedOscAnalog(const String &p_ID, float p_new_value);
-	void treeValueChangedOscMisc(const String &p_ID, float p_new_value);
-	void treeValueChangedOscMulti(const String &p_ID, float p_new_value);
-	void treeValueChangedOscXY(const String &p_ID, float p_new_value);
-	void treeValueChangedOscChip(const String &p_ID, float p_new_value);
-	void treeValueChangedOscArp(const String &p_ID, float p_new_value);
-	void treeValueChangedOscFM(const String &p_ID, float p_new_value);
-	void treeValueChangedOscNoise(const String &p_ID, float p_new_value);
-	void treeValueChangedFilTop(const String &p_ID, float p_new_value);
-	void treeValueChangedFilCenter(const String &p_ID, float p_new_value);
-	void treeValueChangedFilMisc(const String &p_ID, float p_new_value);
-	void treeValueChangedFilFormant(const String &p_ID, float p_new_value);
-	void treeValueChangedAmp(const String &p_ID, float p_new_value);
-	void treeValueChangedDelay(const String &p_ID, float p_new_value);
-	void treeValueChangedReverb(const String &p_ID, float p_new_value);
-	void treeValueChangedChorus(const String &p_ID, float p_new_value);
-	void treeValueChangedPhaser(const String &p_ID, float p_new_value);
-	void treeValueChangedArp(const String &p_ID, float p_new_value);
-	void treeValueChangedFlanger(const String &p_ID, float p_new_value);
-	void treeValueChangedADSR1(const String &p_ID, float p_new_value);
-	void treeValueChangedADSR2(const String &p_ID, float p_new_value);
-	void treeValueChangedADSR3(const String &p_ID, float p_new_value);
-	void treeValueChangedADSR4(const String &p_ID, float p_new_value);
-	void treeValueChangedLFO1(const String &p_ID, float p_new_value);
-	void treeValueChangedLFO2(const String &p_ID, float p_new_value);
-	void treeValueChangedLFO3(const String &p_ID, float p_new_value);
-	void treeValueChangedLFO4(const String &p_ID, float p_new_value);
-	void treeValueChangedGeneralMisc(const String &p_ID, float p_new_value);
+	typedef void (OdinAudioProcessor::*NonParamHandler)(ValueTree &, const Identifier &);
+	// calls p_handler right away, or remembers the change for handOverPatch() while a patch is pending
+	void onNonParamChange(NonParamHandler p_handler, ValueTree &p_tree, const Identifier &p_identifier);
 
 	VoiceManager m_voice_manager;
+	// declared before the tree, so the tree doesn't outlive the listeners
+	OdinParameterDispatcher m_parameter_dispatcher;
 	AudioProcessorValueTreeState m_value_tree;
 
-	OdinTreeListener m_tree_listener_osc_pitch;
-	OdinTreeListener m_tree_listener_osc_misc;
-	OdinTreeListener m_tree_listener_osc_analog;
-	OdinTreeListener m_tree_listener_osc_multi;
-	OdinTreeListener m_tree_listener_osc_xy;
-	OdinTreeListener m_tree_listener_osc_chip;
-	OdinTreeListener m_tree_listener_osc_arp;
-	OdinTreeListener m_tree_listener_osc_fm;
-	OdinTreeListener m_tree_listener_osc_noise;
-	OdinTreeListener m_tree_listener_fil_top;
-	OdinTreeListener m_tree_listener_fil_center;
-	OdinTreeListener m_tree_listener_fil_misc;
-	OdinTreeListener m_tree_listener_fil_formant;
-	OdinTreeListener m_tree_listener_amp;
-	OdinTreeListener m_tree_listener_delay;
-	OdinTreeListener m_tree_listener_reverb;
-	OdinTreeListener m_tree_listener_chorus;
-	OdinTreeListener m_tree_listener_phaser;
-	OdinTreeListener m_tree_listener_arp;
-	OdinTreeListener m_tree_listener_flanger;
-	OdinTreeListener m_tree_listener_adsr1;
-	OdinTreeListener m_tree_listener_adsr2;
-	OdinTreeListener m_tree_listener_adsr3;
-	OdinTreeListener m_tree_listener_adsr4;
-	OdinTreeListener m_tree_listener_lfo1;
-	OdinTreeListener m_tree_listener_lfo2;
-	OdinTreeListener m_tree_listener_lfo3;
-	OdinTreeListener m_tree_listener_lfo4;
-	OdinTreeListener m_tree_listener_general_misc;
-
 	ValueTree m_value_tree_draw;
 	ValueTree m_value_tree_fx;
 	ValueTree m_value_tree_lfo;
@@ -222,6 +225,22 @@ private:
 	Flanger m_flanger[2];
 	Chorus m_chorus[2];
 
+	// stages after the voice sum which go to sleep once their tail died out
+	enum SilenceStage {
+		SilenceFilter3,
+		SilenceDelay,
+		SilencePhaser,
+		SilenceFlanger,
+		SilenceChorus,
+		SilenceReverb,
+		NumberOfSilenceStages
+	};
+	SilenceDetector m_silence_detector[NumberOfSilenceStages];
+	// hides patch changes while audio is running
+	PatchFader m_patch_fader;
+	// m_tuning as a table, read by the voices
+	NoteFrequencyTable m_note_frequencies;
+
 	LFO m_global_lfo;
 	ADSREnvelope m_global_env;
 
@@ -229,11 +248,23 @@ private:
 	ModSources m_mod_sources;
 	ModDestinations m_mod_destinations;
 
-	OdinMidiLearnBase *m_midi_learn_control = nullptr;
-	String m_midi_learn_parameter_ID        = "";
+	// the GUI control which waits for a controller and the parameter it learns. Only used on the message thread,
+	// the editor clears them when it closes
+	OdinMidiLearnBase *m_midi_learn_control              = nullptr;
+	RangedAudioParameter *m_midi_learn_control_parameter = nullptr;
+	RangedAudioParameter *m_midi_learn_parameter         = nullptr;
 	std::multimap<int, RangedAudioParameter *> m_midi_control_param_map;
 	bool m_midi_learn_parameter_active = false;
 
+	// things the audio thread wants to write to the ValueTree or GUI, handled in timerCallback()
+	struct AudioToGUIMessage {
+		enum Type { HostBPM, MidiLearned } type;
+		float BPM;
+		int controller;
+		RangedAudioParameter *parameter;
+	};
+	AudioToGUIQueue<AudioToGUIMessage, AUDIO_TO_GUI_QUEUE_SIZE> m_audio_to_gui_queue;
+
 	float m_osc_vol_smooth[3]             = {1.f, 1.f, 1.f}; // factor
 	float m_fil_gain_smooth[3]            = {1.f, 1.f, 1.f}; // factor
 	float m_osc_vol_control[3]            = {1.f, 1.f, 1.f}; // factor
@@ -250,6 +281,40 @@ private:
 	float m_master_smooth                 = 1.f;
 	float m_master_control                = 1.f; // factor
 
+	// per sample values of the smoothed controls for the current sub-block
+	float m_osc_vol_block[3][SUB_BLOCK_SIZE];
+	float m_fil_gain_block[3][SUB_BLOCK_SIZE];
+	float m_fil_freq_block[3][SUB_BLOCK_SIZE];
+	float m_master_block[SUB_BLOCK_SIZE];
+
+	// scratch buffers for the sub-block renderer
+	float m_voice_buffer[VOICES][2][SUB_BLOCK_SIZE];
+	float m_env_buffer[VOICES][3][SUB_BLOCK_SIZE];
+	float m_lfo_buffer[VOICES][SUB_BLOCK_SIZE]; // lfo1, used for wavetable position mod
+	float m_osc_buffer[VOICES][3][SUB_BLOCK_SIZE];
+	float m_sync_buffer[VOICES][3][SUB_BLOCK_SIZE * OVERSAMPLING_MAX_FACTOR]; // synced oscs at the oversampled rate
+	int m_voice_end[VOICES] = {0}; // samples the voice is alive in the current sub-block
+	float m_filter_input_buffer[VOICES][2][SUB_BLOCK_SIZE]; // per voice, so voices can render in parallel
+	float m_filter_buffer[VOICES][2][SUB_BLOCK_SIZE];
+	float m_fil3_env_buffer[SUB_BLOCK_SIZE];
+	float m_stereo_buffer[2][SUB_BLOCK_SIZE];
+
+	// renders the table reads of several voices at once
+	WavetableOscBank m_osc_bank;
+
+	// renders the filters, amp and distortion of the active voices on several threads
+	VoiceWorkerPool m_voice_worker_pool;
+	int m_voice_threads         = 0;
+	int m_voice_job_num_samples = 0;
+	int m_control_rate          = SUB_BLOCK_SIZE;
+
+	// voice distortion and synced oscs, see setOversampling()
+	int m_oversampling_factor                   = 4;
+	Oversampler::Quality m_oversampling_quality = Oversampler::Low;
+
+	// the oscs only get their wavetables in prepareWavetables()
+	bool m_oscillator_wavetables_loaded = false;
+
 	int m_last_midi_note = -1;
 
 	PlayModes m_mono_poly_legato = PlayModes::Poly;
@@ -309,7 +374,21 @@ private:
 	bool m_is_standalone_plugin = true; // set true since is is only set after createEditor()
 
 	float m_BPM = 120;
-
+	// written by the misc tree listener on the message thread, so the audio thread never touches the ValueTree
+	std::atomic<int> m_unison_voices{1};
+
+	bool m_patch_applied         = false; // the first readPatch() notifies all listeners
+	// set by applyPatch() until handOverPatch(), message thread only
+	bool m_patch_pending      = false;
+	bool m_patch_draw_changed = false;
+	bool m_patch_fading       = false; // handOverPatch() is left to timerCallback()
+	uint32 m_patch_fade_start = 0;
+	struct NonParamChange {
+		NonParamHandler handler;
+		ValueTree tree;
+		Identifier identifier;
+	};
+	std::vector<NonParamChange> m_pending_non_param_changes;
 	bool m_force_values_onto_gui = false; // used for loading state and then remembering to force values once
 	                                      // the editor was created
 
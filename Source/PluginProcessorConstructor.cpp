@@ -27,6 +27,11 @@ OdinAudioProcessor::OdinAudioProcessor() :
 #include "AudioParameterConnections.h" // constains the connection between raw float pointers and their ValueTree counter
 	addNonAudioParametersToTree();
 
+	ConfigFileManager config;
+	setVoiceThreads(config.getOptionVoiceThreads());
+	setControlRate(config.getOptionControlRate());
+	setOversampling(config.getOptionOversampling(), (Oversampler::Quality)config.getOptionOversamplingQuality());
+
 #ifdef WTGEN
 	m_voice[0].wavetable_osc[0].passVariablesToWTDisplay = [&](int p_lower, int p_higher, float p_interpol) {
 		if (m_editor_pointer) {
@@ -38,109 +43,24 @@ OdinAudioProcessor::OdinAudioProcessor() :
 
 	m_is_standalone_plugin = (wrapperType == wrapperType_Standalone);
 
-	m_tree_listener_osc_pitch.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedOscPitch(p_ID, p_new_value);
-	};
-	m_tree_listener_osc_misc.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedOscMisc(p_ID, p_new_value);
-	};
-	m_tree_listener_osc_analog.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedOscAnalog(p_ID, p_new_value);
-	};
-	m_tree_listener_osc_multi.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedOscMulti(p_ID, p_new_value);
-	};
-	m_tree_listener_osc_xy.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedOscXY(p_ID, p_new_value);
-	};
-	m_tree_listener_osc_chip.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedOscChip(p_ID, p_new_value);
-	};
-	m_tree_listener_osc_arp.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedOscArp(p_ID, p_new_value);
-	};
-	m_tree_listener_osc_fm.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedOscFM(p_ID, p_new_value);
-	};
-	m_tree_listener_osc_noise.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedOscNoise(p_ID, p_new_value);
-	};
-	m_tree_listener_fil_top.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedFilTop(p_ID, p_new_value);
-	};
-	m_tree_listener_fil_center.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedFilCenter(p_ID, p_new_value);
-	};
-	m_tree_listener_fil_misc.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedFilMisc(p_ID, p_new_value);
-	};
-	m_tree_listener_fil_formant.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedFilFormant(p_ID, p_new_value);
-	};
-	m_tree_listener_amp.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedAmp(p_ID, p_new_value);
-	};
-	m_tree_listener_delay.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedDelay(p_ID, p_new_value);
-	};
-	m_tree_listener_reverb.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedReverb(p_ID, p_new_value);
-	};
-	m_tree_listener_chorus.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedChorus(p_ID, p_new_value);
-	};
-	m_tree_listener_phaser.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedPhaser(p_ID, p_new_value);
-	};
-	m_tree_listener_arp.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedArp(p_ID, p_new_value);
-	};
-	m_tree_listener_flanger.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedFlanger(p_ID, p_new_value);
-	};
-	m_tree_listener_adsr1.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedADSR1(p_ID, p_new_value);
-	};
-	m_tree_listener_adsr2.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedADSR2(p_ID, p_new_value);
-	};
-	m_tree_listener_adsr3.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedADSR3(p_ID, p_new_value);
-	};
-	m_tree_listener_adsr4.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedADSR4(p_ID, p_new_value);
-	};
-	m_tree_listener_lfo1.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedLFO1(p_ID, p_new_value);
-	};
-	m_tree_listener_lfo2.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedLFO2(p_ID, p_new_value);
-	};
-	m_tree_listener_lfo3.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedLFO3(p_ID, p_new_value);
-	};
-	m_tree_listener_lfo4.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedLFO4(p_ID, p_new_value);
-	};
-	m_tree_listener_general_misc.onValueChange = [&](const String &p_ID, float p_new_value) {
-		treeValueChangedGeneralMisc(p_ID, p_new_value);
-	};
 	m_non_param_listener_fx.onValueChange = [&](ValueTree &tree, const Identifier &identifier) {
-		treeValueChangedNonParamFX(tree, identifier);
+		onNonParamChange(&OdinAudioProcessor::treeValueChangedNonParamFX, tree, identifier);
 	};
 	m_non_param_listener_lfo.onValueChange = [&](ValueTree &tree, const Identifier &identifier) {
-		treeValueChangedNonParamLFO(tree, identifier);
+		onNonParamChange(&OdinAudioProcessor::treeValueChangedNonParamLFO, tree, identifier);
 	};
 	m_non_param_listener_misc.onValueChange = [&](ValueTree &tree, const Identifier &identifier) {
-		treeValueChangedNonParamMisc(tree, identifier);
+		onNonParamChange(&OdinAudioProcessor::treeValueChangedNonParamMisc, tree, identifier);
 	};
 	m_non_param_listener_mod.onValueChange = [&](ValueTree &tree, const Identifier &identifier) {
-		treeValueChangedNonParamMod(tree, identifier);
+		onNonParamChange(&OdinAudioProcessor::treeValueChangedNonParamMod, tree, identifier);
 	};
 	m_non_param_listener_osc.onValueChange = [&](ValueTree &tree, const Identifier &identifier) {
-		treeValueChangedNonParamOsc(tree, identifier);
+		onNonParamChange(&OdinAudioProcessor::treeValueChangedNonParamOsc, tree, identifier);
 	};
 
+	m_note_frequencies.build(m_tuning);
+
 	//distribute WTContainer to audio core
 	for (int i = 0; i < VOICES; ++i) {
 		for (int osc = 0; osc < 3; ++osc) {
@@ -156,7 +76,7 @@ OdinAudioProcessor::OdinAudioProcessor() :
 			m_voice[i].specdraw_osc[osc].setWavetableContainer(&m_WT_container);
 			m_voice[i].lfo[osc].setWavetableContainer(&m_WT_container);
 		}
-		m_voice[i].setTuningPtr(&m_tuning);
+		m_voice[i].setNoteFrequencyTable(&m_note_frequencies);
 
 		m_voice[i].ring_mod[0].setWavetableContainer(&m_WT_container);
 		m_voice[i].ring_mod[1].setWavetableContainer(&m_WT_container);
@@ -169,7 +89,7 @@ OdinAudioProcessor::OdinAudioProcessor() :
 	initializeModules();
 	m_WT_container.loadWavetablesFromConstData();
 
-	// create draw tables
+	// default draw tables, built in the background. prepareWavetables() finishes them before the first block
 	float draw_values[WAVEDRAW_STEPS_X];
 	float spec_values[SPECDRAW_STEPS_X] = {0};
 	float chip_values[CHIPDRAW_STEPS_X] = {0};
@@ -185,43 +105,19 @@ OdinAudioProcessor::OdinAudioProcessor() :
 		}
 	}
 	for (int osc = 0; osc < 3; ++osc) {
-		m_WT_container.createWavedrawTable(osc, draw_values, 44100);
-		m_WT_container.createChipdrawTable(osc, chip_values, 44100);
-		m_WT_container.createSpecdrawTable(osc, spec_values, 44100);
+		m_WT_container.requestWavedrawTable(osc, draw_values, m_WT_container.getSampleRate());
+		m_WT_container.requestChipdrawTable(osc, chip_values, m_WT_container.getSampleRate());
+		m_WT_container.requestSpecdrawTable(osc, spec_values, m_WT_container.getSampleRate());
 	}
 
-	// load wavetables into oscs
+	// the oscs get their wavetables in prepareWavetables(), the host's samplerate is only known then anyway
 	for (int i = 0; i < VOICES; ++i) {
-		for (int osc = 0; osc < 3; ++osc) {
-			m_voice[i].analog_osc[osc].loadWavetables();
-			m_voice[i].wavetable_osc[osc].loadWavetables();
-			m_voice[i].chiptune_osc[osc].loadWavetables();
-			m_voice[i].vector_osc[osc].loadWavetables();
-			m_voice[i].multi_osc[osc].loadWavetables();
-			m_voice[i].fm_osc[osc].loadWavetables();
-			m_voice[i].pm_osc[osc].loadWavetables();
-			m_voice[i].wavedraw_osc[osc].loadWavedrawTables(osc);
-			m_voice[i].chipdraw_osc[osc].loadChipdrawTables(osc);
-			m_voice[i].specdraw_osc[osc].loadSpecdrawTables(osc);
-			m_voice[i].lfo[osc].loadWavetables();
-		}
-		m_voice[i].ring_mod[0].loadWavetables();
-		m_voice[i].ring_mod[1].loadWavetables();
-		m_voice[i].ring_mod[0].selectWavetable(0);
-		m_voice[i].ring_mod[1].selectWavetable(0);
-
 		// set different initial values for filter and mod env here....not best solution
 		m_voice[i].env[1].setDecay(0.8f);
 		m_voice[i].env[1].setSustain(0);
 		m_voice[i].env[2].setDecay(0.8f);
 		m_voice[i].env[2].setSustain(0);
 	}
-	m_ring_mod[0].loadWavetables();
-	m_ring_mod[1].loadWavetables();
-	m_ring_mod[0].selectWavetable(0);
-	m_ring_mod[1].selectWavetable(0);
-
-	m_global_lfo.loadWavetables();
 
 	for (int voice = 0; voice < VOICES; ++voice) {
 		m_voice[voice].env[0].setEnvelopeEndPointers(&(m_voice[voice].m_voice_active),
@@ -254,7 +150,10 @@ OdinAudioProcessor::OdinAudioProcessor() :
 
 	m_master_control = Decibels::decibelsToGain(-7.f);
 	m_master_smooth  = m_master_control;
+
+	startTimer(AUDIO_TO_GUI_INTERVAL_MS);
 }
 
 OdinAudioProcessor::~OdinAudioProcessor() {
+	stopTimer();
 }
\ No newline at end of file
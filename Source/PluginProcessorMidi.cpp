@@ -94,13 +94,17 @@ void OdinAudioProcessor::midiNoteOn(
 	}
 
 	int unison_counter = 0;
-	int unison_voices  = m_value_tree.state.getChildWithName("misc")["unison_voices"];
+	int unison_voices  = m_unison_voices;
 	auto voice_numbers = m_voice_manager.getVoices(p_midi_note, unison_voices);
 	if (m_last_midi_note == -1) {
 		// first time glide - dont glide
 		m_last_midi_note = p_midi_note;
 	}
 	for (int new_voice : voice_numbers) {
+		// destinations of silent voices are not cleared by the modmatrix
+		if (!m_voice[new_voice]) {
+			m_mod_matrix.zeroVoiceDestinations(new_voice);
+		}
 		m_voice[new_voice].start(
 		    p_midi_note,
 		    p_midi_velocity,
@@ -113,19 +117,21 @@ void OdinAudioProcessor::midiNoteOn(
 		    p_arp_mod_1,
 		    p_arp_mod_2);
 		m_voice[new_voice].amp.setMIDIVelocity(p_midi_velocity);
+		m_voice_manager.addActiveVoice(new_voice);
 		m_mod_matrix.setMostRecentVoice(new_voice);
 		++unison_counter;
 	}
 	m_last_midi_note = p_midi_note;
 
 	// set values to filters
+	const float tuned_note = m_note_frequencies.getTunedNote(p_midi_note);
 	for (int stereo = 0; stereo < 2; ++stereo) {
-		m_ladder_filter[stereo].m_MIDI_note = p_midi_note;
-		m_diode_filter[stereo].m_MIDI_note  = p_midi_note;
-		m_korg_filter[stereo].m_MIDI_note   = p_midi_note;
-		m_SEM_filter_12[stereo].m_MIDI_note = p_midi_note;
-		m_comb_filter[stereo].m_MIDI_note   = p_midi_note;
-		m_ring_mod[stereo].m_MIDI_note      = p_midi_note;
+		m_ladder_filter[stereo].m_MIDI_note = tuned_note;
+		m_diode_filter[stereo].m_MIDI_note  = tuned_note;
+		m_korg_filter[stereo].m_MIDI_note   = tuned_note;
+		m_SEM_filter_12[stereo].m_MIDI_note = tuned_note;
+		m_comb_filter[stereo].m_MIDI_note   = tuned_note;
+		m_ring_mod[stereo].m_MIDI_note      = tuned_note;
 
 		m_ladder_filter[stereo].m_MIDI_velocity = p_midi_velocity;
 		m_diode_filter[stereo].m_MIDI_velocity  = p_midi_velocity;
@@ -240,29 +246,12 @@ void OdinAudioProcessor::handleMidiMessage(const MidiMessage &p_midi_message) {
 
 		// midi learn
 		if (m_midi_learn_parameter_active) {
-			m_midi_control_param_map.emplace(p_midi_message.getControllerNumber(),
-			                                 m_value_tree.getParameter(m_midi_learn_parameter_ID));
-			m_midi_learn_control->setMidiControlActive();
+			m_midi_control_param_map.emplace(p_midi_message.getControllerNumber(), m_midi_learn_parameter);
+			// the value tree and the GUI control are updated on the message thread
+			m_audio_to_gui_queue.push(
+			    {AudioToGUIMessage::MidiLearned, 0.f, p_midi_message.getControllerNumber(), m_midi_learn_parameter});
 			m_midi_learn_parameter_active = false;
-			m_midi_learn_control          = nullptr;
-			//add control to value tree
-			m_value_tree.state.getChildWithName("midi_learn")
-			    .setProperty(m_midi_learn_parameter_ID, p_midi_message.getControllerNumber(), nullptr);
-
-			DBG(m_value_tree.state.toXmlString());
-
-			DBG("Added MIDI control for parameter " +
-			    m_midi_control_param_map.find(p_midi_message.getControllerNumber())->second->paramID +
-			    " on controller number " + std::to_string(p_midi_message.getControllerNumber()));
-			m_midi_learn_parameter_ID = "";
-#ifdef ODIN_DEBUG
-			int counter = 1;
-			DBG("=========");
-			for (auto const &control : m_midi_control_param_map) {
-				DBG(std::to_string(counter++) + ": " + control.second->paramID.toStdString());
-			}
-			DBG("=========");
-#endif
+			m_midi_learn_parameter        = nullptr;
 		}
 
 		// do midi control
@@ -279,12 +268,13 @@ void OdinAudioProcessor::handleMidiMessage(const MidiMessage &p_midi_message) {
 
 void OdinAudioProcessor::startMidiLearn(const String &p_parameter_ID, OdinMidiLearnBase *p_GUI_control) {
 	DBG("MIDI LEARN FOR PARAMETER " + p_parameter_ID + " WAS SIGNALED!");
-	if (m_midi_learn_parameter_active) {
+	if (m_midi_learn_control) {
 		m_midi_learn_control->stopMidiLearn();
 	}
-	m_midi_learn_parameter_ID     = p_parameter_ID;
-	m_midi_learn_parameter_active = true;
-	m_midi_learn_control          = p_GUI_control;
+	m_midi_learn_parameter         = m_value_tree.getParameter(p_parameter_ID);
+	m_midi_learn_parameter_active  = true;
+	m_midi_learn_control           = p_GUI_control;
+	m_midi_learn_control_parameter = m_midi_learn_parameter;
 }
 void OdinAudioProcessor::midiForget(const String &p_parameter_ID, OdinMidiLearnBase *p_GUI_control) {
 	for (std::multimap<int, RangedAudioParameter *>::iterator iter = m_midi_control_param_map.begin();
@@ -318,9 +308,10 @@ void OdinAudioProcessor::midiForget(const String &p_parameter_ID, OdinMidiLearnB
 
 void OdinAudioProcessor::stopMidiLearn() {
 
-	m_midi_learn_parameter_active = false;
-	m_midi_learn_parameter_ID     = "";
-	m_midi_learn_control          = nullptr;
+	m_midi_learn_parameter_active  = false;
+	m_midi_learn_parameter         = nullptr;
+	m_midi_learn_control           = nullptr;
+	m_midi_learn_control_parameter = nullptr;
 }
 
 WavetableContainer *OdinAudioProcessor::getWavetableContainerPointer() {
@@ -21,8 +21,19 @@ const String OdinAudioProcessor::getName() const {
 	return JucePlugin_Name;
 }
 
+// release of the amp envelope plus the tails of the enabled FX
 double OdinAudioProcessor::getTailLengthSeconds() const {
-	return 0.0;
+	double tail = *m_env1_release;
+	if (*m_delay_on) {
+		tail += m_delay.getTailSeconds();
+	}
+	if (*m_reverb_on) {
+		tail += m_reverb_zita.getTailSeconds();
+	}
+	if (*m_phaser_on || *m_flanger_on || *m_chorus_on) {
+		tail += SILENCE_HOLD_SECONDS;
+	}
+	return tail;
 }
 
 int OdinAudioProcessor::getNumPrograms() {
@@ -48,11 +59,47 @@ void OdinAudioProcessor::changeProgramName(int index, const String &newName) {
 //==============================================================================
 void OdinAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock) {
 	setSampleRate(sampleRate);
+	prepareWavetables(sampleRate);
+
+	m_voice_worker_pool.setNumberOfWorkers(m_voice_threads);
+
+	for (int voice = 0; voice < VOICES; ++voice) {
+		m_voice[voice].setOversampling(m_oversampling_factor, m_oversampling_quality);
+	}
+	updateLatency();
 }
 
 void OdinAudioProcessor::releaseResources() {
-	// When playback stops, you can use this as an opportunity to free up any
-	// spare memory, etc.
+	// don't keep the voice workers around while nothing is played
+	m_voice_worker_pool.setNumberOfWorkers(0);
+}
+
+void OdinAudioProcessor::setVoiceThreads(int p_threads) {
+	m_voice_threads = jlimit(0, jmin(VOICE_WORKERS_MAX, SystemStats::getNumCpus() - 1), p_threads);
+}
+
+void OdinAudioProcessor::setControlRate(int p_samples) {
+	m_control_rate = jlimit(1, SUB_BLOCK_SIZE, p_samples);
+}
+
+void OdinAudioProcessor::setOversampling(int p_factor, Oversampler::Quality p_quality) {
+	// 2x, 4x or 8x
+	m_oversampling_factor  = p_factor <= 2 ? 2 : (p_factor <= 4 ? 4 : 8);
+	m_oversampling_quality = p_quality == Oversampler::High ? Oversampler::High : Oversampler::Low;
+}
+
+void OdinAudioProcessor::setPatchFadeTime(float p_milliseconds) {
+	m_patch_fader.setFadeTime(p_milliseconds);
+}
+
+void OdinAudioProcessor::setTuning(const Tunings::Tuning &p_tuning) {
+	m_tuning = p_tuning;
+
+	// build it aside, so a starting voice never looks up a half written table
+	NoteFrequencyTable note_frequencies;
+	note_frequencies.build(m_tuning);
+	const ScopedLock lock(getCallbackLock());
+	m_note_frequencies = note_frequencies;
 }
 
 #ifndef JucePlugin_PreferredChannelConfigurations
@@ -79,111 +126,6 @@ AudioProcessorEditor *OdinAudioProcessor::createEditor() {
 	return editor;
 }
 
-//==============================================================================
-void OdinAudioProcessor::getStateInformation(MemoryBlock &destData) {
-	// this is called when DAW saves a file
-
-	auto state = m_value_tree.copyState();
-	std::unique_ptr<XmlElement> xml(state.createXml());
-
-	//add tuning to xml
-	//! XmlElement::addChildElement takes ownership of these, using delete causes segfault
-	XmlElement *scl = new XmlElement("tuning_scl");
-	XmlElement *kbm = new XmlElement("tuning_kbm");
-
-	scl->setAttribute("data", m_tuning.scale.rawText);
-	kbm->setAttribute("data", m_tuning.keyboardMapping.rawText);
-
-	xml->addChildElement(scl);
-	xml->addChildElement(kbm);
-
-	copyXmlToBinary(*xml, destData);
-}
-
-//this is called when DAW restores a file
-void OdinAudioProcessor::setStateInformation(const void *data, int sizeInBytes) {
-
-	// disable for standalone plugins
-	if (wrapperType == wrapperType_Standalone) {
-		return;
-	}
-
-	std::unique_ptr<XmlElement> xmlState(getXmlFromBinary(data, sizeInBytes));
-	if (xmlState.get() != nullptr) {
-
-		//DBG(xmlState->toString());
-
-		//read tunings and remove them from xmltree:
-		Tunings::Scale scl           = Tunings::evenTemperament12NoteScale();
-		Tunings::KeyboardMapping kbm = Tunings::tuneNoteTo(60, Tunings::MIDI_0_FREQ * 32.0);
-		for (auto *child : xmlState->getChildIterator()) {
-			if (child->hasTagName("tuning_scl")) {
-				try {
-					//DBG(child->getStringAttribute("data"));
-					scl = Tunings::parseSCLData(child->getStringAttribute("data").toStdString());
-				} catch (...) {
-					DBG("Failed to load .scl from binary state... resorting to default");
-					scl = Tunings::evenTemperament12NoteScale();
-				}
-			}
-			if (child->hasTagName("tuning_kbm")) {
-				try {
-					//DBG(child->getStringAttribute("data"));
-					kbm = Tunings::parseKBMData(child->getStringAttribute("data").toStdString());
-				} catch (...) {
-					DBG("Failed to load .kbm from binary state... resorting to default");
-					kbm = Tunings::tuneNoteTo(60, Tunings::MIDI_0_FREQ * 32.0);
-				}
-			}
-		}
-		xmlState->deleteAllChildElementsWithTagName("tuning_kbm");
-		xmlState->deleteAllChildElementsWithTagName("tuning_scl");
-		jassert(xmlState->getChildByName("tuning_kbm") == nullptr);
-		jassert(xmlState->getChildByName("tuning_scl") == nullptr);
-
-		m_tuning = Tunings::Tuning(scl, kbm);
-
-		if (xmlState->hasTagName(m_value_tree.state.getType())) {
-
-			//avoid reading from newer patch versions
-			int patch_migration_version_read =
-			    xmlState->getChildByName("misc")->getIntAttribute("patch_migration_version");
-			if (patch_migration_version_read > ODIN_PATCH_MIGRATION_VERSION) {
-				AlertWindow::showMessageBox(
-				    AlertWindow::AlertIconType::WarningIcon,
-				    "You are trying to load a project which was saved with a newer Version of Odin2. Please go to "
-				    "www.thewavewarden.com and download the newest version to properly use this project!",
-				    "Thanks, I will!");
-				return;
-			}
-
-			//load data
-			readPatch(ValueTree::fromXml(*xmlState));
-
-			//set the correct version since an old one was maybe set from patch
-			m_value_tree.state.getChildWithName("misc").setProperty("version_minor", ODIN_MINOR_VERSION, nullptr);
-			m_value_tree.state.getChildWithName("misc").setProperty("version_patch", ODIN_PATCH_VERSION, nullptr);
-			m_value_tree.state.getChildWithName("misc").setProperty(
-			    "patch_migration_version", ODIN_PATCH_MIGRATION_VERSION, nullptr);
-
-			m_force_values_onto_gui = true;
-
-			//create midi learn map from valuetree
-			for (int i = 0; i < m_value_tree_midi_learn.getNumProperties(); ++i) {
-				m_midi_control_param_map.emplace(
-				    (int)m_value_tree_midi_learn[m_value_tree_midi_learn.getPropertyName(i)],
-				    m_value_tree.getParameter(m_value_tree_midi_learn.getPropertyName(i)));
-			}
-
-			createDrawTablesFromValueTree();
-
-			if (m_editor_pointer) {
-				m_editor_pointer->forceValueTreeOntoComponents(false);
-			}
-		}
-	}
-}
-
 //==============================================================================
 // This creates new instances of the plugin..
 AudioProcessor *JUCE_CALLTYPE createPluginFilter() {
@@ -218,6 +160,10 @@ void OdinAudioProcessor::setSampleRate(float p_samplerate) {
 	m_global_env.setSampleRate(p_samplerate);
 	m_global_lfo.setSampleRate(p_samplerate);
 	m_arpeggiator.setSampleRate(p_samplerate);
+	for (int stage = 0; stage < NumberOfSilenceStages; ++stage) {
+		m_silence_detector[stage].setSampleRate(p_samplerate);
+	}
+	m_patch_fader.setSampleRate(p_samplerate);
 
 	//update glide
 	float glide_samplerate_adjusted = pow(GETAUDIO("glide"), 44800. / m_samplerate);
@@ -231,6 +177,7 @@ void OdinAudioProcessor::initializeModules() {
 	m_global_env.setEnvelopeOff(); // so it doesn't start by itself
 
 	m_mod_matrix.setSourcesAndDestinations(&m_mod_sources, &m_mod_destinations);
+	m_mod_matrix.setActiveVoices(m_voice_manager.getActiveVoices(), m_voice_manager.getNumberOfActiveVoicesPointer());
 
 	m_phaser.setRadiusBase(1.25f);
 
@@ -247,6 +194,54 @@ void OdinAudioProcessor::initializeModules() {
 	}
 }
 
+// the oscs keep pointers to the tables of the WavetableContainer
+void OdinAudioProcessor::loadOscillatorWavetables() {
+	for (int i = 0; i < VOICES; ++i) {
+		for (int osc = 0; osc < 3; ++osc) {
+			m_voice[i].analog_osc[osc].loadWavetables();
+			m_voice[i].wavetable_osc[osc].loadWavetables();
+			m_voice[i].chiptune_osc[osc].loadWavetables();
+			m_voice[i].vector_osc[osc].loadWavetables();
+			m_voice[i].multi_osc[osc].loadWavetables();
+			m_voice[i].fm_osc[osc].loadWavetables();
+			m_voice[i].pm_osc[osc].loadWavetables();
+			m_voice[i].wavedraw_osc[osc].loadWavedrawTables(osc);
+			m_voice[i].chipdraw_osc[osc].loadChipdrawTables(osc);
+			m_voice[i].specdraw_osc[osc].loadSpecdrawTables(osc);
+			m_voice[i].lfo[osc].loadWavetables();
+		}
+		m_voice[i].ring_mod[0].loadWavetables();
+		m_voice[i].ring_mod[1].loadWavetables();
+	}
+	m_ring_mod[0].loadWavetables();
+	m_ring_mod[1].loadWavetables();
+
+	m_global_lfo.loadWavetables();
+
+	for (int i = 0; i < VOICES; ++i) {
+		m_voice[i].ring_mod[0].selectWavetable(0);
+		m_voice[i].ring_mod[1].selectWavetable(0);
+	}
+	m_ring_mod[0].selectWavetable(0);
+	m_ring_mod[1].selectWavetable(0);
+
+	m_oscillator_wavetables_loaded = true;
+}
+
+void OdinAudioProcessor::prepareWavetables(double p_samplerate) {
+	// switch to the tables band limited for the host rate
+	if (m_WT_container.getSampleRate() != (float)p_samplerate) {
+		m_WT_container.loadWavetablesForSampleRate(p_samplerate);
+		loadOscillatorWavetables();
+		createDrawTablesFromValueTree();
+	} else if (!m_oscillator_wavetables_loaded) {
+		loadOscillatorWavetables();
+	}
+
+	// don't start playing with draw tables the background builder didn't get to yet
+	m_WT_container.finishDrawTables();
+}
+
 void OdinAudioProcessor::setPitchWheelValue(int p_value) {
 	*m_pitchbend = (float)(p_value - 8192) / 8192.f;
 	updatePitchWheelGUI(*m_pitchbend);
@@ -291,6 +286,13 @@ void OdinAudioProcessor::resetAudioEngine() {
 	m_global_lfo.reset();
 	m_global_env.reset();
 
+	// the reverb keeps its tail, all other stages were cleared
+	for (int stage = 0; stage < NumberOfSilenceStages; ++stage) {
+		if (stage != SilenceReverb) {
+			m_silence_detector[stage].reset();
+		}
+	}
+
 	m_voice_manager.reset();
 }
 
@@ -327,27 +329,6 @@ void OdinAudioProcessor::setFXButtonsPosition(int p_delay, int p_phaser, int p_f
 	m_reverb_position  = p_reverb;
 }
 
-void OdinAudioProcessor::setFilter3EnvValue() {
-
-	// get adsr value newest voice filterenv
-	float env_value = m_adsr[m_voice_manager.getNewestVoiceIndex()][1];
-
-	m_ladder_filter[0].m_env_value  = env_value;
-	m_SEM_filter_12[0].m_env_value  = env_value;
-	m_korg_filter[0].m_env_value    = env_value;
-	m_diode_filter[0].m_env_value   = env_value;
-	m_comb_filter[0].m_env_value    = env_value;
-	m_formant_filter[0].m_env_value = env_value;
-	m_ring_mod[0].m_env_value       = env_value;
-	m_ladder_filter[1].m_env_value  = env_value;
-	m_SEM_filter_12[1].m_env_value  = env_value;
-	m_korg_filter[1].m_env_value    = env_value;
-	m_diode_filter[1].m_env_value   = env_value;
-	m_comb_filter[1].m_env_value    = env_value;
-	m_formant_filter[1].m_env_value = env_value;
-	m_ring_mod[1].m_env_value       = env_value;
-}
-
 void OdinAudioProcessor::attachNonParamListeners() {
 	m_value_tree_fx         = m_value_tree.state.getChildWithName("fx");
 	m_value_tree_osc        = m_value_tree.state.getChildWithName("osc");
@@ -358,8 +339,53 @@ void OdinAudioProcessor::attachNonParamListeners() {
 	m_value_tree_midi_learn = m_value_tree.state.getChildWithName("midi_learn");
 }
 
+void OdinAudioProcessor::timerCallback() {
+	// the distortion is switched from the GUI or a patch, the latency follows it here
+	updateLatency();
+
+	if (m_patch_fading) {
+		checkPatchFade();
+	}
+
+	AudioToGUIMessage message;
+	while (m_audio_to_gui_queue.pop(message)) {
+		switch (message.type) {
+		case AudioToGUIMessage::HostBPM:
+			m_value_tree_misc.setProperty("BPM", message.BPM, nullptr);
+			break;
+		case AudioToGUIMessage::MidiLearned:
+			if (m_midi_learn_control && message.parameter == m_midi_learn_control_parameter) {
+				m_midi_learn_control->setMidiControlActive();
+				m_midi_learn_control           = nullptr;
+				m_midi_learn_control_parameter = nullptr;
+			}
+			if (message.parameter) {
+				//add control to value tree
+				m_value_tree_midi_learn.setProperty(message.parameter->paramID, message.controller, nullptr);
+				DBG("Added MIDI control for parameter " + message.parameter->paramID + " on controller number " +
+				    std::to_string(message.controller));
+			}
+#ifdef ODIN_DEBUG
+			DBG(m_value_tree.state.toXmlString());
+#endif
+			break;
+		}
+	}
+}
+
+void OdinAudioProcessor::updateLatency() {
+	// synced oscs are left out, they only delay one osc against the others of the same voice
+	const int latency = m_dist_on ? roundToInt(m_voice[0].distortion[0].getLatency()) : 0;
+	if (latency != getLatencySamples()) {
+		setLatencySamples(latency);
+	}
+}
+
 void OdinAudioProcessor::onEditorDestruction() {
 	m_editor_pointer = nullptr;
+	// the controls are gone, a controller learned later only ends up in the value tree
+	m_midi_learn_control           = nullptr;
+	m_midi_learn_control_parameter = nullptr;
 }
 
 void OdinAudioProcessor::setMonoPolyLegato(PlayModes p_mode) {
@@ -17,6 +17,11 @@
 
 #include "PluginProcessor.h"
 
+// The host buffer is split into sub-blocks of at most SUB_BLOCK_SIZE samples. Sub-blocks end at MIDI events
+// and arpeggiator notes, so these stay sample accurate. The modmatrix is evaluated once per sub-block, then
+// every module renders the whole sub-block at once: the modulators of all voices, the oscs of all voices (batched
+// over voices where possible), the rest of each voice into its own scratch buffer, then filter 3, the FX chain
+// and the master volume on the summed signal.
 void OdinAudioProcessor::processBlock(AudioBuffer<float> &buffer, MidiBuffer &midiMessages) {
 
 	//avoid denormals
@@ -27,12 +32,31 @@ void OdinAudioProcessor::processBlock(AudioBuffer<float> &buffer, MidiBuffer &mi
 		AudioPlayHead::CurrentPositionInfo current_position_info;
 		playhead->getCurrentPosition(current_position_info);
 		if (m_BPM != current_position_info.bpm) {
-			m_value_tree.state.getChildWithName("misc").setProperty("BPM", m_BPM, nullptr);
+			m_audio_to_gui_queue.push({AudioToGUIMessage::HostBPM, (float)current_position_info.bpm});
 		}
 		m_BPM = current_position_info.bpm;
 	}
 	setBPM(m_BPM);
 
+	// hosts have to call prepareToPlay() first, this only catches the ones which don't
+	if (!m_oscillator_wavetables_loaded) {
+		jassertfalse;
+		prepareWavetables(m_WT_container.getSampleRate());
+	}
+
+	// pick up draw tables which were rebuilt in the background
+	m_WT_container.installDrawTables();
+
+	// parameter changes since the last block
+	m_parameter_dispatcher.applyChanges();
+
+	// skip the whole block while nothing can make a sound
+	if (midiMessages.isEmpty() && isSleeping()) {
+		buffer.clear();
+		m_patch_fader.process(buffer.getWritePointer(0), buffer.getWritePointer(1), buffer.getNumSamples());
+		return;
+	}
+
 	ScopedNoDenormals noDenormals;
 	//auto totalNumInputChannels  = getTotalNumInputChannels();
 	//auto totalNumOutputChannels = getTotalNumOutputChannels();
@@ -46,26 +70,211 @@ void OdinAudioProcessor::processBlock(AudioBuffer<float> &buffer, MidiBuffer &mi
 		midi_message_sample = (*midi_iterator).samplePosition;
 	}
 
-	// loop over samples
-	for (int sample = 0; sample < buffer.getNumSamples(); ++sample) {
+	const int num_samples = buffer.getNumSamples();
+
+	// oscs or filters as modulation sources need the modmatrix at audio rate
+	const int sub_block_size = m_mod_matrix.usesAudioRateSources() ? 1 : m_control_rate;
+
+	// arp events are rendered for a window of samples ahead and fired when the sub-block loop gets to them
+	int arp_window_start = 0;
+	int arp_window_end   = 0;
+	int arp_num_events   = 0;
+	int arp_event_index  = 0;
+
+	// loop over sub-blocks
+	int sample = 0;
+	while (sample < num_samples) {
+
+		//============================================================
+		//========================== MIDI ============================
+		//============================================================
+		while (midi_message_remaining && midi_message_sample <= sample) {
+			ODIN_PROFILE_SCOPE(MidiAndArp);
+			handleMidiMessage(midi_message);
+			// get next midi message
+			midi_iterator++;
+			midi_message_remaining = (midi_iterator != midiMessages.end());
+			if (midi_message_remaining) {
+				midi_message        = (*midi_iterator).getMessage();
+				midi_message_sample = (*midi_iterator).samplePosition;
+			}
+		}
+
+		int sub_block_end = std::min(sample + sub_block_size, num_samples);
+		if (midi_message_remaining && midi_message_sample < sub_block_end) {
+			sub_block_end = midi_message_sample;
+		}
+
+		//============================================================
+		//======================= ARPEGGIATOR ========================
+		//============================================================
 
-		// do Arpeggiator
 		if (m_arpeggiator_on) {
-			int step_active;
-			auto note = m_arpeggiator.getNoteOns(step_active);
-			m_step_led_active.set(step_active);
-			if (std::get<0>(note) != -1) {
-				midiNoteOn(std::get<0>(note), std::get<1>(note), std::get<2>(note), std::get<3>(note));
+			ODIN_PROFILE_SCOPE(MidiAndArp);
+			// the arp only changes with MIDI, so a window ending before the next MIDI event can be rendered at once
+			if (sample >= arp_window_end) {
+				arp_window_start = sample;
+				arp_window_end   = sub_block_end;
+				arp_num_events   = m_arpeggiator.renderEvents(arp_window_end - arp_window_start);
+				arp_event_index  = 0;
+				m_step_led_active.set(m_arpeggiator.getStepActive());
 			}
-			auto off_notes = m_arpeggiator.getNoteOffs();
-			for (auto note_to_kill : off_notes) {
-				midiNoteOff(note_to_kill);
+			arp_event_index = fireArpeggiatorEvents(arp_window_start, sample, arp_event_index, arp_num_events);
+			// the next arp event or the end of the rendered window ends the sub-block
+			sub_block_end = std::min(sub_block_end, arp_window_end);
+			if (arp_event_index < arp_num_events) {
+				sub_block_end =
+				    std::min(sub_block_end, arp_window_start + m_arpeggiator.getEvents()[arp_event_index].sample);
 			}
 		}
 
+		//============================================================
+		//======================= MODMATRIX ==========================
+		//============================================================
+
+		// drop voices which ended in the last sub-block
+		m_voice_manager.removeInactiveVoices();
+
+		{
+			ODIN_PROFILE_SCOPE(ModMatrix);
+			m_mod_matrix.zeroActiveDestinations();
+			m_mod_matrix.applyModulation();
+		}
+
+		const int sub_block_samples = sub_block_end - sample;
+
 		//============================================================
 		//======================= SMOOTHING ==========================
 		//============================================================
+
+		renderSmoothing(sub_block_samples);
+
+		//============================================================
+		//======================== VOICES ============================
+		//============================================================
+
+		// global lfo and envelope
+		{
+			ODIN_PROFILE_SCOPE(Modulators);
+			for (int sub_sample = 0; sub_sample < sub_block_samples; ++sub_sample) {
+				if (m_render_ADSR[1]) {
+					m_global_env_mod_source = m_global_env.doEnvelope();
+				}
+				if (m_render_LFO[3]) {
+					m_global_lfo.update();
+					m_global_lfo_mod_source = m_global_lfo.doOscillate();
+				}
+			}
+		}
+
+		// output var for the individual oscs and filters - these are modulation sources as well
+		memset(m_osc_output, 0, sizeof(float) * VOICES * 3);
+		memset(m_filter_output, 0, sizeof(float) * VOICES * 2);
+		memset(m_stereo_buffer, 0, sizeof(m_stereo_buffer));
+
+		// filter 3 follows the filter envelope of the newest voice
+		const float fil3_env_value = m_adsr[m_voice_manager.getNewestVoiceIndex()][1];
+		for (int sub_sample = 0; sub_sample < sub_block_samples; ++sub_sample) {
+			m_fil3_env_buffer[sub_sample] = fil3_env_value;
+		}
+
+		// loop over active voices
+		const int *active_voices          = m_voice_manager.getActiveVoices();
+		const int number_of_active_voices = m_voice_manager.getNumberOfActiveVoices();
+		for (int index = 0; index < number_of_active_voices; ++index) {
+			renderVoiceModulators(active_voices[index], sub_block_samples);
+		}
+
+		renderOscillators(sub_block_samples);
+
+		// voices are independent from here on, so they can be rendered in parallel
+		m_voice_job_num_samples = sub_block_samples;
+		m_voice_worker_pool.run(number_of_active_voices, renderVoiceJob, this);
+
+		// sum in a fixed order, so the output doesn't depend on which thread rendered which voice
+		for (int index = 0; index < number_of_active_voices; ++index) {
+			const int voice = active_voices[index];
+			for (int sub_sample = 0; sub_sample < sub_block_samples; ++sub_sample) {
+				m_stereo_buffer[0][sub_sample] += m_voice_buffer[voice][0][sub_sample];
+				m_stereo_buffer[1][sub_sample] += m_voice_buffer[voice][1][sub_sample];
+			}
+		} // voice loop
+
+		//===== FILTER 3 ======
+
+		if (m_fil_type[2] != FILTER_TYPE_NONE &&
+		    m_silence_detector[SilenceFilter3].isAwake(m_stereo_buffer[0], m_stereo_buffer[1], sub_block_samples)) {
+			renderFilter3(sub_block_samples);
+			m_silence_detector[SilenceFilter3].checkOutput(
+			    m_stereo_buffer[0], m_stereo_buffer[1], sub_block_samples, SILENCE_HOLD_SECONDS);
+		}
+
+		//==== FX SECTION ====
+
+		renderFX(sub_block_samples);
+
+		//===== OUTPUT ======
+
+		// apply volume & modulation
+		{
+			ODIN_PROFILE_SCOPE(Output);
+			float master_mod[SUB_BLOCK_SIZE];
+			rampModulation(m_master_mod, sub_block_samples, master_mod);
+			auto *channel_data_left  = buffer.getWritePointer(0) + sample;
+			auto *channel_data_right = buffer.getWritePointer(1) + sample;
+			for (int sub_sample = 0; sub_sample < sub_block_samples; ++sub_sample) {
+				const float master_vol_modded = applyVolumeModulation(m_master_block[sub_sample], master_mod[sub_sample]);
+				channel_data_left[sub_sample]  = m_stereo_buffer[0][sub_sample] * master_vol_modded;
+				channel_data_right[sub_sample] = m_stereo_buffer[1][sub_sample] * master_vol_modded;
+			}
+		}
+
+		sample = sub_block_end;
+	} // sub-block loop
+
+	m_patch_fader.process(buffer.getWritePointer(0), buffer.getWritePointer(1), num_samples);
+
+#ifdef ODIN_PROFILING
+	m_profiler.addSamples(num_samples);
+#endif
+}
+
+// fires the arp events of the window starting at p_window_start which are due at p_sample, returns the index of
+// the first event which is still due later
+int OdinAudioProcessor::fireArpeggiatorEvents(int p_window_start, int p_sample, int p_event_index, int p_num_events) {
+	const ArpEvent *events = m_arpeggiator.getEvents();
+	while (p_event_index < p_num_events && p_window_start + events[p_event_index].sample <= p_sample) {
+		const ArpEvent &event = events[p_event_index++];
+		if (event.note_on) {
+			midiNoteOn(event.note, event.velocity, event.mod_1, event.mod_2);
+		} else {
+			midiNoteOff(event.note);
+		}
+	}
+	return p_event_index;
+}
+
+bool OdinAudioProcessor::isSleeping() const {
+	if (m_voice_manager.getNumberOfActiveVoices() > 0 || (m_arpeggiator_on && !m_arpeggiator.isIdle())) {
+		return false;
+	}
+	const bool stage_on[NumberOfSilenceStages] = {m_fil_type[2] != FILTER_TYPE_NONE,
+	                                              *m_delay_on > 0.5f,
+	                                              *m_phaser_on > 0.5f,
+	                                              *m_flanger_on > 0.5f,
+	                                              *m_chorus_on > 0.5f,
+	                                              *m_reverb_on > 0.5f};
+	for (int stage = 0; stage < NumberOfSilenceStages; ++stage) {
+		if (stage_on[stage] && !m_silence_detector[stage].isSleeping()) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void OdinAudioProcessor::renderSmoothing(int p_num_samples) {
+	// these are read by the modules on each sample
+	for (int sample = 0; sample < p_num_samples; ++sample) {
 		for (int i = 0; i < 3; ++i) {
 			m_osc_vol_smooth[i] =
 			    m_osc_vol_smooth[i] * GAIN_SMOOTHIN_FACTOR + (1.f - GAIN_SMOOTHIN_FACTOR) * m_osc_vol_control[i];
@@ -74,429 +283,709 @@ void OdinAudioProcessor::processBlock(AudioBuffer<float> &buffer, MidiBuffer &mi
 
 			m_fil_freq_smooth[i] = m_fil_freq_smooth[i] * FILTER_FREQ_SMOOTHING_FACTOR +
 			                       (1.f - FILTER_FREQ_SMOOTHING_FACTOR) * m_fil_freq_control[i];
+
+			m_osc_vol_block[i][sample]  = m_osc_vol_smooth[i];
+			m_fil_gain_block[i][sample] = m_fil_gain_smooth[i];
+			m_fil_freq_block[i][sample] = m_fil_freq_smooth[i];
 		}
+		m_master_smooth = m_master_smooth * GAIN_SMOOTHIN_FACTOR + (1 - GAIN_SMOOTHIN_FACTOR) * (m_master_control);
+		m_master_block[sample] = m_master_smooth;
 
+		// these are read through modulation pointers, so they are control rate
 		m_pitch_bend_smooth =
 		    m_pitch_bend_smooth * PITCHBEND_SMOOTHIN_FACTOR + (1.f - PITCHBEND_SMOOTHIN_FACTOR) * (*m_pitchbend);
-
-		m_pitch_bend_smooth_and_applied = m_pitch_bend_smooth * m_pitchbend_amount;
-
 		m_modwheel_smooth =
 		    m_modwheel_smooth * PITCHBEND_SMOOTHIN_FACTOR + (1.f - PITCHBEND_SMOOTHIN_FACTOR) * (*m_modwheel);
-
 		m_x_smooth = m_x_smooth * PAD_SMOOTHIN_FACTOR + (1.f - PAD_SMOOTHIN_FACTOR) * (*m_xy_x);
 		m_y_smooth = m_y_smooth * PAD_SMOOTHIN_FACTOR + (1.f - PAD_SMOOTHIN_FACTOR) * (*m_xy_y);
+	}
 
-		if (*m_x_mod) {
-			m_x_modded = m_x_smooth + *m_x_mod;
-			m_x_modded = m_x_modded > 1.f ? 1.f : m_x_modded;
-			m_x_modded = m_x_modded < 0.f ? 0.f : m_x_modded;
-		} else {
-			m_x_modded = m_x_smooth;
+	m_pitch_bend_smooth_and_applied = m_pitch_bend_smooth * m_pitchbend_amount;
+
+	if (*m_x_mod) {
+		m_x_modded = m_x_smooth + *m_x_mod;
+		m_x_modded = m_x_modded > 1.f ? 1.f : m_x_modded;
+		m_x_modded = m_x_modded < 0.f ? 0.f : m_x_modded;
+	} else {
+		m_x_modded = m_x_smooth;
+	}
+	if (*m_y_mod) {
+		m_y_modded = m_y_smooth + *m_y_mod;
+		m_y_modded = m_y_modded > 1.f ? 1.f : m_y_modded;
+		m_y_modded = m_y_modded < 0.f ? 0.f : m_y_modded;
+	} else {
+		m_y_modded = m_y_smooth;
+	}
+}
+
+// linear ramp of a modulation destination over a sub-block, from its value in the last sub-block to the current one.
+// Pitch and FM destinations aren't ramped, they step once per sub-block
+void OdinAudioProcessor::rampModulation(const float *p_destination, int p_num_samples, float *p_ramp) const {
+	const float target = *p_destination;
+	const float start  = m_mod_matrix.getPreviousValue(p_destination);
+	if (start == target) {
+		for (int sample = 0; sample < p_num_samples; ++sample) {
+			p_ramp[sample] = target;
 		}
-		if (*m_y_mod) {
-			m_y_modded = m_y_smooth + *m_y_mod;
-			m_y_modded = m_y_modded > 1.f ? 1.f : m_y_modded;
-			m_y_modded = m_y_modded < 0.f ? 0.f : m_y_modded;
+		return;
+	}
+	const float step = (target - start) / (float)p_num_samples;
+	for (int sample = 0; sample < p_num_samples - 1; ++sample) {
+		p_ramp[sample] = start + step * (float)(sample + 1);
+	}
+	p_ramp[p_num_samples - 1] = target;
+}
+
+float OdinAudioProcessor::applyVolumeModulation(float p_volume, float p_mod) {
+	if (!p_mod) {
+		return p_volume;
+	}
+	float vol_modded = p_volume;
+	if (p_mod < 0.f) {
+		//negative modulation just modulates down to -inf dB
+		vol_modded = p_volume * (1.f + p_mod);
+		vol_modded = vol_modded < 0 ? 0 : vol_modded;
+	} else {
+		if (p_volume > MINUS_12_dB_GAIN) {
+			// volume level above -12dB, modulate to plus 12 dB
+			vol_modded *= pow(PLUS_12_dB_GAIN, p_mod);
+			vol_modded = vol_modded > PLUS_12_dB_GAIN ? PLUS_12_dB_GAIN : vol_modded;
 		} else {
-			m_y_modded = m_y_smooth;
+			// if volume level is below -12dB then just modulate up to 0dB
+			vol_modded += (1.f - vol_modded) * p_mod;
+			vol_modded = vol_modded > PLUS_12_dB_GAIN ? PLUS_12_dB_GAIN : vol_modded;
 		}
+	}
+	return vol_modded;
+}
 
-		m_master_smooth = m_master_smooth * GAIN_SMOOTHIN_FACTOR + (1 - GAIN_SMOOTHIN_FACTOR) * (m_master_control);
+// renders envelopes and lfos of one voice into its modulator buffers
+void OdinAudioProcessor::renderVoiceModulators(int p_voice, int p_num_samples) {
+	ODIN_PROFILE_SCOPE(Modulators);
 
-		//============================================================
-		//========================== MIDI ============================
-		//============================================================
-		while (midi_message_remaining && midi_message_sample <= sample) {
-			handleMidiMessage(midi_message);
-			// get next midi message
-			midi_iterator++;
-			midi_message_remaining = (midi_iterator != midiMessages.end());
-			if (midi_message_remaining) {
-				midi_message        = (*midi_iterator).getMessage();
-				midi_message_sample = (*midi_iterator).samplePosition;
+	Voice &voice = m_voice[p_voice];
+
+	// the amp envelope might end the voice inside the sub-block, stop rendering there
+	m_voice_end[p_voice] = p_num_samples;
+	for (int sample = 0; sample < p_num_samples; ++sample) {
+		for (int mod = 0; mod < 3; ++mod) {
+			if (mod < 2 || m_render_ADSR[mod - 2]) {
+				m_adsr[p_voice][mod] = voice.env[mod].doEnvelope();
+			}
+			m_env_buffer[p_voice][mod][sample] = m_adsr[p_voice][mod];
+
+			if (m_render_LFO[mod]) {
+				voice.lfo[mod].update();
+				m_lfo[p_voice][mod] = voice.lfo[mod].doOscillate();
 			}
 		}
+		m_lfo_buffer[p_voice][sample] = m_lfo[p_voice][0];
 
-		//============================================================
-		//======================= MODMATRIX ==========================
-		//============================================================
+		if (!voice) {
+			m_voice_end[p_voice] = sample + 1;
+			break;
+		}
+	}
+}
 
-		m_mod_matrix.zeroAllDestinations();
-		m_mod_matrix.applyModulation();
+// renders the oscs of all active voices. Table reads of the same osc slot are batched over voices
+void OdinAudioProcessor::renderOscillators(int p_num_samples) {
+	ODIN_PROFILE_SCOPE(Oscillators);
 
-		//============================================================
-		//======================== VOICES ============================
-		//============================================================
+	const int *active_voices          = m_voice_manager.getActiveVoices();
+	const int number_of_active_voices = m_voice_manager.getNumberOfActiveVoices();
 
-		// global lfo and envelope
-		if (m_render_ADSR[1]) {
-			m_global_env_mod_source = m_global_env.doEnvelope();
+	if (*m_osc_sync[1] || *m_osc_sync[2]) {
+		// hard sync reads the reset flag of osc1 on every sample, so render the oscs interleaved
+		for (int index = 0; index < number_of_active_voices; ++index) {
+			const int voice = active_voices[index];
+			for (int sample = 0; sample < m_voice_end[voice]; ++sample) {
+				for (int osc = 0; osc < 3; ++osc) {
+					renderOscillator(voice, osc, sample, sample + 1);
+				}
+			}
 		}
-		if (m_render_LFO[3]) {
-			m_global_lfo.update();
-			m_global_lfo_mod_source = m_global_lfo.doOscillate();
+	} else {
+		renderOscillatorBanks(p_num_samples);
+	}
+
+	// synced oscs rendered into m_sync_buffer, bring them back to the base rate once per sub-block
+	for (int index = 0; index < number_of_active_voices; ++index) {
+		const int voice = active_voices[index];
+		for (int osc = 1; osc < 3; ++osc) {
+			if (WavetableOsc1D *synced_osc = getSyncedOscillator(voice, osc)) {
+				synced_osc->downsampleSync(m_sync_buffer[voice][osc], m_osc_buffer[voice][osc], m_voice_end[voice]);
+			}
 		}
+	}
+}
 
-		float stereo_signal[2] = {0};
+// renders the oscs of all active voices osc by osc, without hard sync between them
+void OdinAudioProcessor::renderOscillatorBanks(int p_num_samples) {
+	const int *active_voices          = m_voice_manager.getActiveVoices();
+	const int number_of_active_voices = m_voice_manager.getNumberOfActiveVoices();
+
+	for (int osc = 0; osc < 3; ++osc) {
+		switch (m_osc_type[osc]) {
+		case OSC_TYPE_ANALOG:
+			renderOscillatorBank(osc, p_num_samples, [osc](Voice &p_voice) { return &p_voice.analog_osc[osc]; });
+			break;
+		case OSC_TYPE_WAVEDRAW:
+			renderOscillatorBank(osc, p_num_samples, [osc](Voice &p_voice) { return &p_voice.wavedraw_osc[osc]; });
+			break;
+		case OSC_TYPE_CHIPDRAW:
+			renderOscillatorBank(osc, p_num_samples, [osc](Voice &p_voice) { return &p_voice.chipdraw_osc[osc]; });
+			break;
+		case OSC_TYPE_SPECDRAW:
+			renderOscillatorBank(osc, p_num_samples, [osc](Voice &p_voice) { return &p_voice.specdraw_osc[osc]; });
+			break;
+		default:
+			for (int index = 0; index < number_of_active_voices; ++index) {
+				const int voice = active_voices[index];
+				renderOscillator(voice, osc, 0, m_voice_end[voice]);
+			}
+			break;
+		}
+	}
+}
 
-		// output var for the individual oscs and filters - these are modulation sources as well
-		memset(m_osc_output, 0, sizeof(float) * VOICES * 3);
-		memset(m_filter_output, 0, sizeof(float) * VOICES * 2);
+// renders one osc slot of all active voices through m_osc_bank, OSC_BANK_LANES voices at a time.
+// p_get_osc returns the osc of the slot for a voice. Lanes run for the whole sub-block even if their voice
+// ends inside it, the samples after the voice end are discarded anyways.
+template <class GetOsc>
+void OdinAudioProcessor::renderOscillatorBank(int p_osc, int p_num_samples, GetOsc p_get_osc) {
+	typedef typename std::remove_pointer<decltype(p_get_osc(m_voice[0]))>::type OscType;
+
+	OscType *oscs[OSC_BANK_LANES];
+	float *outputs[OSC_BANK_LANES];
+	int lanes = 0;
+
+	const int *active_voices = m_voice_manager.getActiveVoices();
+	for (int index = 0; index < m_voice_manager.getNumberOfActiveVoices(); ++index) {
+		const int voice = active_voices[index];
+		OscType *osc    = p_get_osc(m_voice[voice]);
+		if (!osc->isPlainWavetable()) {
+			renderOscillator(voice, p_osc, 0, m_voice_end[voice]);
+			continue;
+		}
 
-		// loop over all voices
-		for (int voice = 0; voice < VOICES; ++voice) {
-			if (m_voice[voice]) {
-
-				for (int mod = 0; mod < 3; ++mod) {
-					//===== ADSR ======
-					if (mod < 2 || m_render_ADSR[mod - 2]) {
-						m_adsr[voice][mod] = m_voice[voice].env[mod].doEnvelope();
-					}
-
-					//====== LFO ======
-					if (m_render_LFO[mod]) {
-						// DBG("RENDER LFO " + std::to_string(mod));
-						m_voice[voice].lfo[mod].update();
-						m_lfo[voice][mod] = m_voice[voice].lfo[mod].doOscillate();
-					}
-				}
+		oscs[lanes]    = osc;
+		outputs[lanes] = m_osc_buffer[voice][p_osc];
+		if (++lanes == OSC_BANK_LANES) {
+			m_osc_bank.render(oscs, outputs, lanes, p_num_samples);
+			lanes = 0;
+		}
+	}
+	if (lanes) {
+		m_osc_bank.render(oscs, outputs, lanes, p_num_samples);
+	}
+}
 
-				//===== OSCS ======
+void OdinAudioProcessor::renderVoiceJob(void *p_processor, int p_index) {
+	auto *processor = static_cast<OdinAudioProcessor *>(p_processor);
+	processor->renderVoice(processor->m_voice_manager.getActiveVoices()[p_index], processor->m_voice_job_num_samples);
+}
 
-				for (int osc = 0; osc < 3; ++osc) {
+// renders everything after the oscs for one voice. Only touches state of this voice, see renderVoiceJob()
+void OdinAudioProcessor::renderVoice(int p_voice, int p_num_samples) {
 
-					switch (m_osc_type[osc]) {
-					case OSC_TYPE_ANALOG:
-						m_voice[voice].analog_osc[osc].update();
-						m_osc_output[voice][osc] += m_voice[voice].analog_osc[osc].doOscillateWithSync();
-						break;
-					case OSC_TYPE_WAVETABLE:
-						m_voice[voice].wavetable_osc[osc].update();
-						//set modulation envelope/lfo
-						m_voice[voice].wavetable_osc[osc].setPosModValue(
-						    m_osc_wavetable_source_lfo[osc] ? m_lfo[voice][0] : m_adsr[voice][2]);
-						m_osc_output[voice][osc] += m_voice[voice].wavetable_osc[osc].doOscillateWithSync();
-						break;
-					case OSC_TYPE_MULTI:
-						m_voice[voice].multi_osc[osc].update();
-						m_osc_output[voice][osc] += m_voice[voice].multi_osc[osc].doOscillate();
-						break;
-					case OSC_TYPE_VECTOR:
-						m_voice[voice].vector_osc[osc].update();
-						m_osc_output[voice][osc] += m_voice[voice].vector_osc[osc].doOscillateWithSync();
-						break;
-					case OSC_TYPE_CHIPTUNE:
-						m_voice[voice].chiptune_osc[osc].update();
-						m_osc_output[voice][osc] += m_voice[voice].chiptune_osc[osc].doOscillateWithSync();
-						break;
-					case OSC_TYPE_FM:
-						m_voice[voice].fm_osc[osc].update();
-						m_osc_output[voice][osc] += m_voice[voice].fm_osc[osc].doOscillate();
-						break;
-					case OSC_TYPE_PM:
-						m_voice[voice].pm_osc[osc].update();
-						m_osc_output[voice][osc] += m_voice[voice].pm_osc[osc].doOscillate();
-						break;
-					case OSC_TYPE_NOISE:
-						m_osc_output[voice][osc] += m_voice[voice].noise_osc[osc].doNoise();
-						break;
-					case OSC_TYPE_WAVEDRAW:
-						m_voice[voice].wavedraw_osc[osc].update();
-						m_osc_output[voice][osc] += m_voice[voice].wavedraw_osc[osc].doOscillateWithSync();
-						break;
-					case OSC_TYPE_CHIPDRAW:
-						m_voice[voice].chipdraw_osc[osc].update();
-						m_osc_output[voice][osc] += m_voice[voice].chipdraw_osc[osc].doOscillateWithSync();
-						break;
-					case OSC_TYPE_SPECDRAW:
-						m_voice[voice].specdraw_osc[osc].update();
-						m_osc_output[voice][osc] += m_voice[voice].specdraw_osc[osc].doOscillateWithSync();
-						break;
-					default:
-						break;
-					}
-
-					// apply volume & modulation
-					float osc_vol_modded = m_osc_vol_smooth[osc];
-					if (*m_osc_vol_mod[voice][osc]) {
-						if (*m_osc_vol_mod[voice][osc] < 0.f) {
-							//negative modulation just modulates down to -inf dB
-							osc_vol_modded = m_osc_vol_smooth[osc] * (1.f + *m_osc_vol_mod[voice][osc]);
-							osc_vol_modded = osc_vol_modded < 0 ? 0 : osc_vol_modded;
-						} else {
-							if (m_osc_vol_smooth[osc] > MINUS_12_dB_GAIN) {
-								// volume level above -12dB, modulate to plus 12 dB
-								osc_vol_modded *= pow(PLUS_12_dB_GAIN, *m_osc_vol_mod[voice][osc]);
-								osc_vol_modded = osc_vol_modded > PLUS_12_dB_GAIN ? PLUS_12_dB_GAIN : osc_vol_modded;
-							} else {
-								// if volume level is below -12dB then just modulate up to 0dB
-								osc_vol_modded += (1.f - osc_vol_modded) * *m_osc_vol_mod[voice][osc];
-								osc_vol_modded = osc_vol_modded > PLUS_12_dB_GAIN ? PLUS_12_dB_GAIN : osc_vol_modded;
-							}
-						}
-					}
-					m_osc_output[voice][osc] *= osc_vol_modded;
-				} // osc loop
-
-				//===== FILTERS ======
-
-				float filter_input[2] = {0};
-				m_voice[voice].setFilterEnvValue(m_adsr[voice][1]); // can be split up to individual filters
-				for (int fil = 0; fil < 2; ++fil) {
-					// get filter inputs, fil1->fil2 is done at the end of fil1 calc
-					if (*m_fil_osc1[fil]) {
-						filter_input[fil] += m_osc_output[voice][0];
-					}
-					if (*m_fil_osc2[fil]) {
-						filter_input[fil] += m_osc_output[voice][1];
-					}
-					if (*m_fil_osc3[fil]) {
-						filter_input[fil] += m_osc_output[voice][2];
-					}
-					switch (m_fil_type[fil]) {
-					case FILTER_TYPE_NONE:
-					default:
-						m_filter_output[voice][fil] = filter_input[fil];
-						break;
-					case FILTER_TYPE_LP24:
-					case FILTER_TYPE_LP12:
-					case FILTER_TYPE_BP24:
-					case FILTER_TYPE_BP12:
-					case FILTER_TYPE_HP24:
-					case FILTER_TYPE_HP12:
-						m_voice[voice].ladder_filter[fil].m_freq_base = m_fil_freq_smooth[fil];
-						m_voice[voice].ladder_filter[fil].update();
-						m_filter_output[voice][fil] = m_voice[voice].ladder_filter[fil].doFilter(filter_input[fil]);
-						break;
-					case FILTER_TYPE_SEM12:
-						m_voice[voice].SEM_filter_12[fil].m_freq_base = m_fil_freq_smooth[fil];
-						m_voice[voice].SEM_filter_12[fil].update();
-						m_filter_output[voice][fil] = m_voice[voice].SEM_filter_12[fil].doFilter(filter_input[fil]);
-						break;
-					case FILTER_TYPE_KORG_LP:
-					case FILTER_TYPE_KORG_HP:
-						m_voice[voice].korg_filter[fil].m_freq_base = m_fil_freq_smooth[fil];
-						m_voice[voice].korg_filter[fil].update();
-						m_filter_output[voice][fil] = m_voice[voice].korg_filter[fil].doFilter(filter_input[fil]);
-						break;
-					case FILTER_TYPE_DIODE:
-						m_voice[voice].diode_filter[fil].m_freq_base = m_fil_freq_smooth[fil];
-						m_voice[voice].diode_filter[fil].update();
-						m_filter_output[voice][fil] = m_voice[voice].diode_filter[fil].doFilter(filter_input[fil]);
-						break;
-					case FILTER_TYPE_FORMANT:
-						m_voice[voice].formant_filter[fil].m_freq_base = m_fil_freq_smooth[fil];
-						m_voice[voice].formant_filter[fil].update();
-						m_filter_output[voice][fil] = m_voice[voice].formant_filter[fil].doFilter(filter_input[fil]);
-						break;
-					case FILTER_TYPE_COMB:
-						m_voice[voice].comb_filter[fil].setCombFreq(m_fil_freq_smooth[fil]);
-						m_filter_output[voice][fil] = m_voice[voice].comb_filter[fil].doFilter(filter_input[fil]);
-						break;
-					case FILTER_TYPE_RINGMOD:
-						m_voice[voice].ring_mod[fil].setBaseFrequency(m_fil_freq_smooth[fil]);
-						m_voice[voice].ring_mod[fil].setGlideTargetFrequency(m_fil_freq_smooth[fil]);
-						m_voice[voice].ring_mod[fil].update();
-						m_filter_output[voice][fil] = m_voice[voice].ring_mod[fil].doRingModulator(filter_input[fil]);
-						break;
-					}
-
-					//apply gain & -modulation
-					if (m_fil_type[fil] != FILTER_TYPE_NONE) {
-						// apply volume & modulation
-						float fil_vol_modded = m_fil_gain_smooth[fil];
-						if (*m_fil_12_vol_mod[voice][fil]) {
-							if (*m_fil_12_vol_mod[voice][fil] < 0.f) {
-								//negative modulation just modulates down to -inf dB
-								fil_vol_modded = m_fil_gain_smooth[fil] * (1.f + *m_fil_12_vol_mod[voice][fil]);
-								fil_vol_modded = fil_vol_modded < 0 ? 0 : fil_vol_modded;
-							} else {
-								if (m_fil_gain_smooth[fil] > MINUS_12_dB_GAIN) {
-									// volume level above -12dB, modulate to plus 12 dB
-									fil_vol_modded *= pow(PLUS_12_dB_GAIN, *m_fil_12_vol_mod[voice][fil]);
-									fil_vol_modded =
-									    fil_vol_modded > PLUS_12_dB_GAIN ? PLUS_12_dB_GAIN : fil_vol_modded;
-								} else {
-									// if volume level is below -12dB then just modulate up to 0dB
-									fil_vol_modded += (1.f - fil_vol_modded) * *m_fil_12_vol_mod[voice][fil];
-									fil_vol_modded =
-									    fil_vol_modded > PLUS_12_dB_GAIN ? PLUS_12_dB_GAIN : fil_vol_modded;
-								}
-							}
-						}
-						m_filter_output[voice][fil] *= fil_vol_modded;
-					}
-
-					// add first filter to second filter input
-					if (fil == 0 && *m_fil2_fil1) {
-						filter_input[1] += m_filter_output[voice][0];
-					}
-				} // filter loop
-
-				float voices_output = 0;
-
-				if (*m_fil1_to_amp) {
-					voices_output += m_filter_output[voice][0];
-				}
-				if (*m_fil2_to_amp) {
-					voices_output += m_filter_output[voice][1];
-				}
+	Voice &voice = m_voice[p_voice];
 
-				//SIGNAL IS POLY STEREO FROM HERE ON
-				float stereo_signal_voice[2];
+	const int voice_end                   = m_voice_end[p_voice];
+	float(*osc_buffer)[SUB_BLOCK_SIZE]    = m_osc_buffer[p_voice];
+	float(*filter_buffer)[SUB_BLOCK_SIZE] = m_filter_buffer[p_voice];
 
-				//===== AMPLIFIER ======
-				m_voice[voice].amp.doAmplifier(voices_output, stereo_signal_voice[0], stereo_signal_voice[1]);
+	//===== OSCS ======
 
-				//===== DISTORTION ======
-				if (m_dist_on) {
-					stereo_signal_voice[0] = m_voice[voice].distortion[0].doDistortion(stereo_signal_voice[0]);
-					stereo_signal_voice[1] = m_voice[voice].distortion[1].doDistortion(stereo_signal_voice[1]);
-				}
+	// apply volume & modulation
+	for (int osc = 0; osc < 3; ++osc) {
+		float vol_mod[SUB_BLOCK_SIZE];
+		rampModulation(m_osc_vol_mod[p_voice][osc], p_num_samples, vol_mod);
+		for (int sample = 0; sample < voice_end; ++sample) {
+			osc_buffer[osc][sample] *= applyVolumeModulation(m_osc_vol_block[osc][sample], vol_mod[sample]);
+		}
+		m_osc_output[p_voice][osc] = osc_buffer[osc][voice_end - 1];
+	}
+
+	//===== FILTERS ======
+
+	for (int fil = 0; fil < 2; ++fil) {
+		// get filter inputs
+		const bool osc1_to_fil = *m_fil_osc1[fil];
+		const bool osc2_to_fil = *m_fil_osc2[fil];
+		const bool osc3_to_fil = *m_fil_osc3[fil];
+		const bool fil1_to_fil = fil == 1 && *m_fil2_fil1;
+		for (int sample = 0; sample < voice_end; ++sample) {
+			float filter_input = 0.f;
+			if (osc1_to_fil) {
+				filter_input += osc_buffer[0][sample];
+			}
+			if (osc2_to_fil) {
+				filter_input += osc_buffer[1][sample];
+			}
+			if (osc3_to_fil) {
+				filter_input += osc_buffer[2][sample];
+			}
+			if (fil1_to_fil) {
+				filter_input += filter_buffer[0][sample];
+			}
+			m_filter_input_buffer[p_voice][fil][sample] = filter_input;
+		}
+
+		ODIN_PROFILE_SCOPE(Filters);
+		renderFilter(p_voice, fil, voice_end);
+		m_filter_output[p_voice][fil] = filter_buffer[fil][voice_end - 1];
+	}
+
+	const bool fil1_to_amp = *m_fil1_to_amp;
+	const bool fil2_to_amp = *m_fil2_to_amp;
+
+	//SIGNAL IS POLY STEREO FROM HERE ON
+	float *voice_left  = m_voice_buffer[p_voice][0];
+	float *voice_right = m_voice_buffer[p_voice][1];
+
+	//===== AMPLIFIER ======
+	{
+		ODIN_PROFILE_SCOPE(Amplifier);
+		ModDestAmp &amp_mod = m_mod_destinations.voice[p_voice].amp;
+		const ModDestAmp amp_mod_value = amp_mod;
+		float gain_mod[SUB_BLOCK_SIZE];
+		float pan_mod[SUB_BLOCK_SIZE];
+		rampModulation(&amp_mod.gain, p_num_samples, gain_mod);
+		rampModulation(&amp_mod.pan, p_num_samples, pan_mod);
+		for (int sample = 0; sample < voice_end; ++sample) {
+			// the amp reads the modulation through its pointers
+			amp_mod.gain        = gain_mod[sample];
+			amp_mod.pan         = pan_mod[sample];
+			float voices_output = 0;
+			if (fil1_to_amp) {
+				voices_output += filter_buffer[0][sample];
+			}
+			if (fil2_to_amp) {
+				voices_output += filter_buffer[1][sample];
+			}
+			voice.amp.doAmplifier(voices_output, voice_left[sample], voice_right[sample]);
+		}
+		amp_mod = amp_mod_value;
+	}
+
+	//===== DISTORTION ======
+	if (m_dist_on) {
+		ODIN_PROFILE_SCOPE(Distortion);
+		voice.distortion[0].doDistortion(voice_left, voice_end);
+		voice.distortion[1].doDistortion(voice_right, voice_end);
+	}
+
+	//apply amp envelope, counted as amplifier as well
+	{
+		ODIN_PROFILE_SCOPE(Amplifier);
+		for (int sample = 0; sample < voice_end; ++sample) {
+			voice_left[sample] *= m_env_buffer[p_voice][0][sample];
+			voice_right[sample] *= m_env_buffer[p_voice][0][sample];
+		}
+	}
+
+	// voice has ended
+	for (int sample = voice_end; sample < p_num_samples; ++sample) {
+		voice_left[sample]  = 0.f;
+		voice_right[sample] = 0.f;
+	}
+
+	// filter 3 follows the newest voice
+	if (p_voice == m_voice_manager.getNewestVoiceIndex()) {
+		for (int sample = 0; sample < p_num_samples; ++sample) {
+			m_fil3_env_buffer[sample] = m_adsr[p_voice][1];
+		}
+		for (int sample = 0; sample < voice_end; ++sample) {
+			m_fil3_env_buffer[sample] = m_env_buffer[p_voice][1][sample];
+		}
+	}
+}
 
-				//apply amp envelope
-				stereo_signal[0] += stereo_signal_voice[0] * m_adsr[voice][0];
-				stereo_signal[1] += stereo_signal_voice[1] * m_adsr[voice][0];
-			} // voice active
-		}     // voice loop
+// renders samples [p_start, p_end) of one oscillator into m_osc_buffer
+void OdinAudioProcessor::renderOscillator(int p_voice, int p_osc, int p_start, int p_end) {
 
-		for (int channel = 0; channel < 2; ++channel) {
+	Voice &voice  = m_voice[p_voice];
+	float *output = m_osc_buffer[p_voice][p_osc];
 
-			//===== FILTER 3 ======
+	switch (m_osc_type[p_osc]) {
+	case OSC_TYPE_ANALOG:
+		for (int sample = p_start; sample < p_end; ++sample) {
+			voice.analog_osc[p_osc].update();
+			output[sample] = oscillateWithSync(voice.analog_osc[p_osc], p_voice, p_osc, sample);
+		}
+		break;
+	case OSC_TYPE_WAVETABLE: {
+		//set modulation envelope/lfo
+		const float *pos_mod =
+		    m_osc_wavetable_source_lfo[p_osc] ? m_lfo_buffer[p_voice] : m_env_buffer[p_voice][2];
+		for (int sample = p_start; sample < p_end; ++sample) {
+			voice.wavetable_osc[p_osc].update();
+			voice.wavetable_osc[p_osc].setPosModValue(pos_mod[sample]);
+			output[sample] = oscillateWithSync(voice.wavetable_osc[p_osc], p_voice, p_osc, sample);
+		}
+	} break;
+	case OSC_TYPE_MULTI:
+		for (int sample = p_start; sample < p_end; ++sample) {
+			voice.multi_osc[p_osc].update();
+			output[sample] = voice.multi_osc[p_osc].doOscillate();
+		}
+		break;
+	case OSC_TYPE_VECTOR:
+		for (int sample = p_start; sample < p_end; ++sample) {
+			voice.vector_osc[p_osc].update();
+			output[sample] = oscillateWithSync(voice.vector_osc[p_osc], p_voice, p_osc, sample);
+		}
+		break;
+	case OSC_TYPE_CHIPTUNE:
+		for (int sample = p_start; sample < p_end; ++sample) {
+			voice.chiptune_osc[p_osc].update();
+			output[sample] = oscillateWithSync(voice.chiptune_osc[p_osc], p_voice, p_osc, sample);
+		}
+		break;
+	case OSC_TYPE_FM:
+		for (int sample = p_start; sample < p_end; ++sample) {
+			voice.fm_osc[p_osc].update();
+			output[sample] = voice.fm_osc[p_osc].doOscillate();
+		}
+		break;
+	case OSC_TYPE_PM:
+		for (int sample = p_start; sample < p_end; ++sample) {
+			voice.pm_osc[p_osc].update();
+			output[sample] = voice.pm_osc[p_osc].doOscillate();
+		}
+		break;
+	case OSC_TYPE_NOISE:
+		for (int sample = p_start; sample < p_end; ++sample) {
+			output[sample] = voice.noise_osc[p_osc].doNoise();
+		}
+		break;
+	case OSC_TYPE_WAVEDRAW:
+		for (int sample = p_start; sample < p_end; ++sample) {
+			voice.wavedraw_osc[p_osc].update();
+			output[sample] = oscillateWithSync(voice.wavedraw_osc[p_osc], p_voice, p_osc, sample);
+		}
+		break;
+	case OSC_TYPE_CHIPDRAW:
+		for (int sample = p_start; sample < p_end; ++sample) {
+			voice.chipdraw_osc[p_osc].update();
+			output[sample] = oscillateWithSync(voice.chipdraw_osc[p_osc], p_voice, p_osc, sample);
+		}
+		break;
+	case OSC_TYPE_SPECDRAW:
+		for (int sample = p_start; sample < p_end; ++sample) {
+			voice.specdraw_osc[p_osc].update();
+			output[sample] = oscillateWithSync(voice.specdraw_osc[p_osc], p_voice, p_osc, sample);
+		}
+		break;
+	default:
+		for (int sample = p_start; sample < p_end; ++sample) {
+			output[sample] = 0.f;
+		}
+		break;
+	}
+}
 
-			setFilter3EnvValue();
+// a synced osc writes the oversampled samples of p_sample to m_sync_buffer, renderOscillators() downsamples them
+float OdinAudioProcessor::oscillateWithSync(WavetableOsc1D &p_osc, int p_voice, int p_osc_index, int p_sample) {
+	if (p_osc.isSynced()) {
+		p_osc.doOscillateSynced(m_sync_buffer[p_voice][p_osc_index] + p_sample * p_osc.getSyncOversamplingFactor());
+		return 0.f;
+	}
+	return p_osc.doOscillate();
+}
 
-			switch (m_fil_type[2]) {
-			case FILTER_TYPE_LP24:
-			case FILTER_TYPE_LP12:
-			case FILTER_TYPE_BP24:
-			case FILTER_TYPE_BP12:
-			case FILTER_TYPE_HP24:
-			case FILTER_TYPE_HP12:
-				m_ladder_filter[channel].m_freq_base = m_fil_freq_smooth[2];
+// the osc renderOscillator() uses for the slot if it is hard synced, else nullptr
+WavetableOsc1D *OdinAudioProcessor::getSyncedOscillator(int p_voice, int p_osc) {
+	Voice &voice        = m_voice[p_voice];
+	WavetableOsc1D *osc = nullptr;
+	switch (m_osc_type[p_osc]) {
+	case OSC_TYPE_ANALOG:
+		osc = &voice.analog_osc[p_osc];
+		break;
+	case OSC_TYPE_WAVETABLE:
+		osc = &voice.wavetable_osc[p_osc];
+		break;
+	case OSC_TYPE_VECTOR:
+		osc = &voice.vector_osc[p_osc];
+		break;
+	case OSC_TYPE_CHIPTUNE:
+		osc = &voice.chiptune_osc[p_osc];
+		break;
+	case OSC_TYPE_WAVEDRAW:
+		osc = &voice.wavedraw_osc[p_osc];
+		break;
+	case OSC_TYPE_CHIPDRAW:
+		osc = &voice.chipdraw_osc[p_osc];
+		break;
+	case OSC_TYPE_SPECDRAW:
+		osc = &voice.specdraw_osc[p_osc];
+		break;
+	default:
+		break;
+	}
+	return osc && osc->isSynced() ? osc : nullptr;
+}
+
+// renders one voice filter from m_filter_input_buffer into m_filter_buffer of the voice
+void OdinAudioProcessor::renderFilter(int p_voice, int p_fil, int p_num_samples) {
+
+	Voice &voice       = m_voice[p_voice];
+	const float *input = m_filter_input_buffer[p_voice][p_fil];
+	float *output      = m_filter_buffer[p_voice][p_fil];
+	const float *env   = m_env_buffer[p_voice][1];
+	const float *freq  = m_fil_freq_block[p_fil];
+
+	// the filters read the modulation through their pointer on every sample, so ramp it there
+	float *freq_mod            = &m_mod_destinations.voice[p_voice].filter[p_fil].freq;
+	const float freq_mod_value = *freq_mod;
+	float freq_mod_ramp[SUB_BLOCK_SIZE];
+	rampModulation(freq_mod, p_num_samples, freq_mod_ramp);
+
+	switch (m_fil_type[p_fil]) {
+	case FILTER_TYPE_NONE:
+	default:
+		for (int sample = 0; sample < p_num_samples; ++sample) {
+			output[sample] = input[sample];
+		}
+		// no gain stage
+		return;
+	case FILTER_TYPE_LP24:
+	case FILTER_TYPE_LP12:
+	case FILTER_TYPE_BP24:
+	case FILTER_TYPE_BP12:
+	case FILTER_TYPE_HP24:
+	case FILTER_TYPE_HP12:
+		for (int sample = 0; sample < p_num_samples; ++sample) {
+			*freq_mod = freq_mod_ramp[sample];
+			voice.ladder_filter[p_fil].m_env_value = env[sample];
+			voice.ladder_filter[p_fil].m_freq_base = freq[sample];
+			voice.ladder_filter[p_fil].update();
+			output[sample] = voice.ladder_filter[p_fil].doFilter(input[sample]);
+		}
+		break;
+	case FILTER_TYPE_SEM12:
+		for (int sample = 0; sample < p_num_samples; ++sample) {
+			*freq_mod = freq_mod_ramp[sample];
+			voice.SEM_filter_12[p_fil].m_env_value = env[sample];
+			voice.SEM_filter_12[p_fil].m_freq_base = freq[sample];
+			voice.SEM_filter_12[p_fil].update();
+			output[sample] = voice.SEM_filter_12[p_fil].doFilter(input[sample]);
+		}
+		break;
+	case FILTER_TYPE_KORG_LP:
+	case FILTER_TYPE_KORG_HP:
+		for (int sample = 0; sample < p_num_samples; ++sample) {
+			*freq_mod = freq_mod_ramp[sample];
+			voice.korg_filter[p_fil].m_env_value = env[sample];
+			voice.korg_filter[p_fil].m_freq_base = freq[sample];
+			voice.korg_filter[p_fil].update();
+			output[sample] = voice.korg_filter[p_fil].doFilter(input[sample]);
+		}
+		break;
+	case FILTER_TYPE_DIODE:
+		for (int sample = 0; sample < p_num_samples; ++sample) {
+			*freq_mod = freq_mod_ramp[sample];
+			voice.diode_filter[p_fil].m_env_value = env[sample];
+			voice.diode_filter[p_fil].m_freq_base = freq[sample];
+			voice.diode_filter[p_fil].update();
+			output[sample] = voice.diode_filter[p_fil].doFilter(input[sample]);
+		}
+		break;
+	case FILTER_TYPE_FORMANT:
+		for (int sample = 0; sample < p_num_samples; ++sample) {
+			*freq_mod = freq_mod_ramp[sample];
+			voice.formant_filter[p_fil].m_env_value = env[sample];
+			voice.formant_filter[p_fil].m_freq_base = freq[sample];
+			voice.formant_filter[p_fil].update();
+			output[sample] = voice.formant_filter[p_fil].doFilter(input[sample]);
+		}
+		break;
+	case FILTER_TYPE_COMB:
+		for (int sample = 0; sample < p_num_samples; ++sample) {
+			*freq_mod = freq_mod_ramp[sample];
+			voice.comb_filter[p_fil].m_env_value = env[sample];
+			voice.comb_filter[p_fil].setCombFreq(freq[sample]);
+			output[sample] = voice.comb_filter[p_fil].doFilter(input[sample]);
+		}
+		break;
+	case FILTER_TYPE_RINGMOD:
+		for (int sample = 0; sample < p_num_samples; ++sample) {
+			*freq_mod = freq_mod_ramp[sample];
+			voice.ring_mod[p_fil].m_env_value = env[sample];
+			voice.ring_mod[p_fil].setBaseFrequency(freq[sample]);
+			voice.ring_mod[p_fil].setGlideTargetFrequency(freq[sample]);
+			voice.ring_mod[p_fil].update();
+			output[sample] = voice.ring_mod[p_fil].doRingModulator(input[sample]);
+		}
+		break;
+	}
+
+	*freq_mod = freq_mod_value;
+
+	//apply gain & -modulation
+	float vol_mod[SUB_BLOCK_SIZE];
+	rampModulation(m_fil_12_vol_mod[p_voice][p_fil], p_num_samples, vol_mod);
+	for (int sample = 0; sample < p_num_samples; ++sample) {
+		output[sample] *= applyVolumeModulation(m_fil_gain_block[p_fil][sample], vol_mod[sample]);
+	}
+}
+
+void OdinAudioProcessor::renderFilter3(int p_num_samples) {
+	ODIN_PROFILE_SCOPE(Filter3);
+
+	const float *env  = m_fil3_env_buffer;
+	const float *freq = m_fil_freq_block[2];
+
+	float *freq_mod            = &m_mod_destinations.filter3.freq;
+	const float freq_mod_value = *freq_mod;
+	float freq_mod_ramp[SUB_BLOCK_SIZE];
+	rampModulation(freq_mod, p_num_samples, freq_mod_ramp);
+	float vol_mod[SUB_BLOCK_SIZE];
+	rampModulation(m_fil_3_vol_mod, p_num_samples, vol_mod);
+
+	for (int channel = 0; channel < 2; ++channel) {
+		float *signal = m_stereo_buffer[channel];
+
+		switch (m_fil_type[2]) {
+		case FILTER_TYPE_LP24:
+		case FILTER_TYPE_LP12:
+		case FILTER_TYPE_BP24:
+		case FILTER_TYPE_BP12:
+		case FILTER_TYPE_HP24:
+		case FILTER_TYPE_HP12:
+			for (int sample = 0; sample < p_num_samples; ++sample) {
+				*freq_mod = freq_mod_ramp[sample];
+				m_ladder_filter[channel].m_env_value = env[sample];
+				m_ladder_filter[channel].m_freq_base = freq[sample];
 				m_ladder_filter[channel].update();
-				stereo_signal[channel] = m_ladder_filter[channel].doFilter(stereo_signal[channel]);
-				break;
-			case FILTER_TYPE_SEM12:
-				m_SEM_filter_12[channel].m_freq_base = m_fil_freq_smooth[2];
+				signal[sample] = m_ladder_filter[channel].doFilter(signal[sample]);
+			}
+			break;
+		case FILTER_TYPE_SEM12:
+			for (int sample = 0; sample < p_num_samples; ++sample) {
+				*freq_mod = freq_mod_ramp[sample];
+				m_SEM_filter_12[channel].m_env_value = env[sample];
+				m_SEM_filter_12[channel].m_freq_base = freq[sample];
 				m_SEM_filter_12[channel].update();
-				stereo_signal[channel] = m_SEM_filter_12[channel].doFilter(stereo_signal[channel]);
-				break;
-			case FILTER_TYPE_KORG_LP:
-			case FILTER_TYPE_KORG_HP:
-				m_korg_filter[channel].m_freq_base = m_fil_freq_smooth[2];
+				signal[sample] = m_SEM_filter_12[channel].doFilter(signal[sample]);
+			}
+			break;
+		case FILTER_TYPE_KORG_LP:
+		case FILTER_TYPE_KORG_HP:
+			for (int sample = 0; sample < p_num_samples; ++sample) {
+				*freq_mod = freq_mod_ramp[sample];
+				m_korg_filter[channel].m_env_value = env[sample];
+				m_korg_filter[channel].m_freq_base = freq[sample];
 				m_korg_filter[channel].update();
-				stereo_signal[channel] = m_korg_filter[channel].doFilter(stereo_signal[channel]);
-				break;
-			case FILTER_TYPE_DIODE:
-				m_diode_filter[channel].m_freq_base = m_fil_freq_smooth[2];
+				signal[sample] = m_korg_filter[channel].doFilter(signal[sample]);
+			}
+			break;
+		case FILTER_TYPE_DIODE:
+			for (int sample = 0; sample < p_num_samples; ++sample) {
+				*freq_mod = freq_mod_ramp[sample];
+				m_diode_filter[channel].m_env_value = env[sample];
+				m_diode_filter[channel].m_freq_base = freq[sample];
 				m_diode_filter[channel].update();
-				stereo_signal[channel] = m_diode_filter[channel].doFilter(stereo_signal[channel]);
-				break;
-			case FILTER_TYPE_FORMANT:
-				m_formant_filter[channel].m_freq_base = m_fil_freq_smooth[2];
+				signal[sample] = m_diode_filter[channel].doFilter(signal[sample]);
+			}
+			break;
+		case FILTER_TYPE_FORMANT:
+			for (int sample = 0; sample < p_num_samples; ++sample) {
+				*freq_mod = freq_mod_ramp[sample];
+				m_formant_filter[channel].m_env_value = env[sample];
+				m_formant_filter[channel].m_freq_base = freq[sample];
 				m_formant_filter[channel].update();
-				stereo_signal[channel] = m_formant_filter[channel].doFilter(stereo_signal[channel]);
-				break;
-			case FILTER_TYPE_COMB:
-				m_comb_filter[channel].setCombFreq(m_fil_freq_smooth[2]);
-				stereo_signal[channel] = m_comb_filter[channel].doFilter(stereo_signal[channel]);
-				break;
-			case FILTER_TYPE_RINGMOD:
-				m_ring_mod[channel].setBaseFrequency(m_fil_freq_smooth[2]);
-				m_ring_mod[channel].setGlideTargetFrequency(m_fil_freq_smooth[2]);
-
-				m_ring_mod[channel].update();
-				stereo_signal[channel] = m_ring_mod[channel].doRingModulator(stereo_signal[channel]);
-				break;
-			default:
-				break;
+				signal[sample] = m_formant_filter[channel].doFilter(signal[sample]);
 			}
-			//apply gain & -modulation
-			if (m_fil_type[2] != FILTER_TYPE_NONE) {
-				// apply volume & modulation
-				float fil_vol_modded = m_fil_gain_smooth[2];
-				if (*m_fil_3_vol_mod) {
-					if (*m_fil_3_vol_mod < 0.f) {
-						//negative modulation just modulates down to -inf dB
-						fil_vol_modded = m_fil_gain_smooth[2] * (1.f + *m_fil_3_vol_mod);
-						fil_vol_modded = fil_vol_modded < 0 ? 0 : fil_vol_modded;
-					} else {
-						if (m_fil_gain_smooth[2] > MINUS_12_dB_GAIN) {
-							// volume level above -12dB, modulate to plus 12 dB
-							fil_vol_modded *= pow(PLUS_12_dB_GAIN, *m_fil_3_vol_mod);
-							fil_vol_modded = fil_vol_modded > PLUS_12_dB_GAIN ? PLUS_12_dB_GAIN : fil_vol_modded;
-						} else {
-							// if volume level is below -12dB then just modulate up to 0dB
-							fil_vol_modded += (1.f - fil_vol_modded) * *m_fil_3_vol_mod;
-							fil_vol_modded = fil_vol_modded > PLUS_12_dB_GAIN ? PLUS_12_dB_GAIN : fil_vol_modded;
-						}
-					}
-				}
-				stereo_signal[channel] *= fil_vol_modded;
+			break;
+		case FILTER_TYPE_COMB:
+			for (int sample = 0; sample < p_num_samples; ++sample) {
+				*freq_mod = freq_mod_ramp[sample];
+				m_comb_filter[channel].m_env_value = env[sample];
+				m_comb_filter[channel].setCombFreq(freq[sample]);
+				signal[sample] = m_comb_filter[channel].doFilter(signal[sample]);
+			}
+			break;
+		case FILTER_TYPE_RINGMOD:
+			for (int sample = 0; sample < p_num_samples; ++sample) {
+				*freq_mod = freq_mod_ramp[sample];
+				m_ring_mod[channel].m_env_value = env[sample];
+				m_ring_mod[channel].setBaseFrequency(freq[sample]);
+				m_ring_mod[channel].setGlideTargetFrequency(freq[sample]);
+				m_ring_mod[channel].update();
+				signal[sample] = m_ring_mod[channel].doRingModulator(signal[sample]);
 			}
-		} // stereo loop
+			break;
+		default:
+			break;
+		}
 
-		//==== FX SECTION ====
+		*freq_mod = freq_mod_value;
 
-		// ugly solution, yet here we go:
-		// check for each fx if its position is slot and then render it
-		// todo this section should really be solved with function pointers! This is ugly code
-		for (int fx_slot = 0; fx_slot < 5; ++fx_slot) {
-			if (m_delay_position == fx_slot) {
-				if (*m_delay_on) {
-					stereo_signal[0] = m_delay.doDelayLeft(stereo_signal[0]);
-					stereo_signal[1] = m_delay.doDelayRight(stereo_signal[1]);
-				}
-			} else if (m_phaser_position == fx_slot) {
-				if (*m_phaser_on) {
-					stereo_signal[0] = m_phaser.doPhaserLeft(stereo_signal[0]);
-					stereo_signal[1] = m_phaser.doPhaserRight(stereo_signal[1]);
-				}
-			} else if (m_flanger_position == fx_slot) {
-				if (*m_flanger_on) {
-					stereo_signal[0] = m_flanger[0].doFlanger(stereo_signal[0]);
-					stereo_signal[1] = m_flanger[1].doFlanger(stereo_signal[1]);
+		//apply gain & -modulation
+		if (m_fil_type[2] != FILTER_TYPE_NONE) {
+			for (int sample = 0; sample < p_num_samples; ++sample) {
+				signal[sample] *= applyVolumeModulation(m_fil_gain_block[2][sample], vol_mod[sample]);
+			}
+		}
+	} // stereo loop
+}
+
+void OdinAudioProcessor::renderFX(int p_num_samples) {
+
+	float *left  = m_stereo_buffer[0];
+	float *right = m_stereo_buffer[1];
+
+	// ugly solution, yet here we go:
+	// check for each fx if its position is slot and then render it
+	// todo this section should really be solved with function pointers! This is ugly code
+	for (int fx_slot = 0; fx_slot < 5; ++fx_slot) {
+		if (m_delay_position == fx_slot) {
+			if (*m_delay_on && m_silence_detector[SilenceDelay].isAwake(left, right, p_num_samples)) {
+				ODIN_PROFILE_SCOPE(Delay);
+				for (int sample = 0; sample < p_num_samples; ++sample) {
+					left[sample]  = m_delay.doDelayLeft(left[sample]);
+					right[sample] = m_delay.doDelayRight(right[sample]);
 				}
-			} else if (m_chorus_position == fx_slot) {
-				if (*m_chorus_on) {
-					stereo_signal[0] = m_chorus[0].doChorus(stereo_signal[0]);
-					stereo_signal[1] = m_chorus[1].doChorus(stereo_signal[1]);
+				// the output is silent between two echoes
+				m_silence_detector[SilenceDelay].checkOutput(
+				    left, right, p_num_samples, m_delay.getMaxDelayTime() + SILENCE_HOLD_SECONDS);
+			}
+		} else if (m_phaser_position == fx_slot) {
+			if (*m_phaser_on && m_silence_detector[SilencePhaser].isAwake(left, right, p_num_samples)) {
+				ODIN_PROFILE_SCOPE(Phaser);
+				for (int sample = 0; sample < p_num_samples; ++sample) {
+					left[sample]  = m_phaser.doPhaserLeft(left[sample]);
+					right[sample] = m_phaser.doPhaserRight(right[sample]);
 				}
-			} else if (m_reverb_position == fx_slot) {
-				if (*m_reverb_on) {
-					m_reverb_zita.process(stereo_signal);
+				m_silence_detector[SilencePhaser].checkOutput(left, right, p_num_samples, SILENCE_HOLD_SECONDS);
+			}
+		} else if (m_flanger_position == fx_slot) {
+			if (*m_flanger_on && m_silence_detector[SilenceFlanger].isAwake(left, right, p_num_samples)) {
+				ODIN_PROFILE_SCOPE(Flanger);
+				for (int sample = 0; sample < p_num_samples; ++sample) {
+					left[sample]  = m_flanger[0].doFlanger(left[sample]);
+					right[sample] = m_flanger[1].doFlanger(right[sample]);
 				}
+				m_silence_detector[SilenceFlanger].checkOutput(left, right, p_num_samples, SILENCE_HOLD_SECONDS);
 			}
-		}
-
-		//===== OUTPUT ======
-
-		// apply volume & modulation
-		float master_vol_modded = m_master_smooth;
-		if (*m_master_mod) {
-			if (*m_master_mod < 0.f) {
-				//negative modulation just modulates down to -inf dB
-				master_vol_modded = m_master_smooth * (1.f + *m_master_mod);
-				master_vol_modded = master_vol_modded < 0 ? 0 : master_vol_modded;
-			} else {
-				if (m_master_smooth > MINUS_12_dB_GAIN) {
-					// volume level above -12dB, modulate to plus 12 dB
-					master_vol_modded *= pow(PLUS_12_dB_GAIN, *m_master_mod);
-					master_vol_modded = master_vol_modded > PLUS_12_dB_GAIN ? PLUS_12_dB_GAIN : master_vol_modded;
-				} else {
-					// if volume level is below -12dB then just modulate up to 0dB
-					master_vol_modded += (1.f - master_vol_modded) * *m_master_mod;
-					master_vol_modded = master_vol_modded > PLUS_12_dB_GAIN ? PLUS_12_dB_GAIN : master_vol_modded;
+		} else if (m_chorus_position == fx_slot) {
+			if (*m_chorus_on && m_silence_detector[SilenceChorus].isAwake(left, right, p_num_samples)) {
+				ODIN_PROFILE_SCOPE(Chorus);
+				for (int sample = 0; sample < p_num_samples; ++sample) {
+					left[sample]  = m_chorus[0].doChorus(left[sample]);
+					right[sample] = m_chorus[1].doChorus(right[sample]);
 				}
+				m_silence_detector[SilenceChorus].checkOutput(left, right, p_num_samples, SILENCE_HOLD_SECONDS);
+			}
+		} else if (m_reverb_position == fx_slot) {
+			if (*m_reverb_on && m_silence_detector[SilenceReverb].isAwake(left, right, p_num_samples)) {
+				ODIN_PROFILE_SCOPE(Reverb);
+				m_reverb_zita.processBlock(left, right, p_num_samples);
+				m_silence_detector[SilenceReverb].checkOutput(
+				    left, right, p_num_samples, m_reverb_zita.getMaxDelayTime() + SILENCE_HOLD_SECONDS);
 			}
 		}
-
-		auto *channelData   = buffer.getWritePointer(0);
-		channelData[sample] = stereo_signal[0] * master_vol_modded;
-		channelData         = buffer.getWritePointer(1);
-		channelData[sample] = stereo_signal[1] * master_vol_modded;
-
-	} // sample loop
+	}
 }
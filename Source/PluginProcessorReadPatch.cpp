@@ -17,6 +17,38 @@
 
 #include "PluginProcessor.h"
 
+// fills everything an older patch doesn't have yet from the init patch. The draw values are left out, they are
+// generated from scratch in readPatch()
+static void fillFromInitPatch(ValueTree &p_patch, const ValueTree &p_init_patch) {
+	for (int i = 0; i < p_init_patch.getNumChildren(); ++i) {
+		const ValueTree init_child = p_init_patch.getChild(i);
+
+		// all children which are an audio param have two properties (name and value)
+		if (init_child.getNumProperties() == 2) {
+			const Identifier &name_property = init_child.getPropertyName(0);
+			if (!p_patch.getChildWithProperty(name_property, init_child[name_property]).isValid()) {
+				p_patch.appendChild(init_child.createCopy(), nullptr);
+			}
+			continue;
+		}
+
+		if (init_child.hasType("draw") || init_child.hasType("midi_learn")) {
+			continue;
+		}
+		ValueTree child = p_patch.getChildWithName(init_child.getType());
+		if (!child.isValid()) {
+			p_patch.appendChild(init_child.createCopy(), nullptr);
+			continue;
+		}
+		for (int property = 0; property < init_child.getNumProperties(); ++property) {
+			const Identifier &name = init_child.getPropertyName(property);
+			if (!child.hasProperty(name)) {
+				child.setProperty(name, init_child[name], nullptr);
+			}
+		}
+	}
+}
+
 // read patch by iterating over all attritubes,
 // setting them if they are available and setting to default if not
 void OdinAudioProcessor::readPatch(const ValueTree &newState) {
@@ -40,101 +72,75 @@ void OdinAudioProcessor::readPatch(const ValueTree &newState) {
 	    std::to_string(ODIN_PATCH_MIGRATION_VERSION));
 
 	if (patch_migration_version < ODIN_PATCH_MIGRATION_VERSION) {
-		DBG("Preset seems to be from older version... loading init priset first...");
+		DBG("Preset seems to be from older version... filling it up from the init patch...");
 
 		// replace stream with patch from binary data
 		MemoryInputStream init_stream(BinaryData::init_patch_odin, BinaryData::init_patch_odinSize, false);
-		readPatch(ValueTree::readFromStream(init_stream));
+		auto init_patch = ValueTree::readFromStream(init_stream);
+		migratePatch(init_patch);
+		fillFromInitPatch(newStateMigrated, init_patch);
+	}
 
-		DBG("Done loading init patch");
+	// the trees, the GUI and the host get the new values right away. The audio engine takes them over once the
+	// output faded out, timerCallback() polls for that so the message thread never waits for the audio thread
+	applyPatch(newStateMigrated);
+	if (!m_patch_fading) {
+		m_patch_fading     = m_patch_fader.fadeOut();
+		m_patch_fade_start = Time::getMillisecondCounter();
 	}
+	if (!m_patch_fading || !MessageManager::existsAndIsCurrentThread()) {
+		handOverPatch();
+	}
+}
+
+// called by timerCallback() while a patch waits for the fade out. Audio which stopped meanwhile never gets there
+void OdinAudioProcessor::checkPatchFade() {
+	if (m_patch_fader.isSilent() ||
+	    Time::getMillisecondCounter() - m_patch_fade_start > PATCH_FADE_MAX_WAIT_MILLISECONDS) {
+		handOverPatch();
+	}
+}
+
+void OdinAudioProcessor::applyPatch(const ValueTree &newStateMigrated) {
+	// the audio engine keeps the old patch meanwhile: the non-param listeners only collect their changes and the
+	// parameter changes stay queued
+	m_patch_pending = true;
+	m_parameter_dispatcher.hold();
+
+	// after construction the audio engine was never synced with the tree, so the first patch sends everything
+	const bool notify_all = !m_patch_applied;
+	m_patch_applied       = true;
 
 	const ValueTree &draw_tree = newStateMigrated.getChildWithName("draw");
 
 	//if new value has no draw tree, create it from scratch
+	bool draw_changed = notify_all;
 	for (int osc = 1; osc < 4; ++osc) {
 		if (!(draw_tree.hasProperty(String("osc" + std::to_string(osc) + "_wavedraw_values_0")))) {
 			DBG("Tree has no wavedraw" + std::to_string(osc) + " values, fallback to generation");
 			writeDefaultWavedrawValuesToTree(osc);
+			draw_changed = true;
 		}
 
 		if (!(draw_tree.hasProperty(String("osc" + std::to_string(osc) + "_chipdraw_values_0")))) {
 			DBG("Tree has no chipdraw" + std::to_string(osc) + " values, fallback to generation");
 			writeDefaultChipdrawValuesToTree(osc);
+			draw_changed = true;
 		}
 
 		if (!(draw_tree.hasProperty(String("osc" + std::to_string(osc) + "_specdraw_values_0")))) {
 			DBG("Tree has no specdraw" + std::to_string(osc) + " values, fallback to generation");
 			writeDefaultSpecdrawValuesToTree(osc);
+			draw_changed = true;
 		}
 	}
 
-	for (int i = 0; i < m_value_tree_draw.getNumProperties(); ++i) {
-		if (draw_tree.hasProperty(m_value_tree_draw.getPropertyName(i))) {
-			m_value_tree_draw.setProperty(m_value_tree_draw.getPropertyName(i),
-			                              draw_tree.getProperty(m_value_tree_draw.getPropertyName(i)),
-			                              nullptr);
-			m_value_tree_draw.sendPropertyChangeMessage((m_value_tree_draw.getPropertyName(i)));
-		} else {
-			//DBG("Didn't find non-audio property (draw) " +
-			//    m_value_tree_draw.getPropertyName(i).toString().toStdString());
-		}
-	}
-	const ValueTree &osc_tree = newStateMigrated.getChildWithName("osc");
-	for (int i = 0; i < m_value_tree_osc.getNumProperties(); ++i) {
-		if (osc_tree.hasProperty(m_value_tree_osc.getPropertyName(i))) {
-			m_value_tree_osc.setProperty(m_value_tree_osc.getPropertyName(i),
-			                             osc_tree.getProperty(m_value_tree_osc.getPropertyName(i)),
-			                             nullptr);
-			m_value_tree_osc.sendPropertyChangeMessage((m_value_tree_osc.getPropertyName(i)));
-		} else {
-			DBG("Didn't find non-audio property (osc) " + m_value_tree_osc.getPropertyName(i).toString().toStdString());
-		}
-	}
-	const ValueTree &fx_tree = newStateMigrated.getChildWithName("fx");
-	for (int i = 0; i < m_value_tree_fx.getNumProperties(); ++i) {
-		if (fx_tree.hasProperty(m_value_tree_fx.getPropertyName(i))) {
-			m_value_tree_fx.setProperty(
-			    m_value_tree_fx.getPropertyName(i), fx_tree.getProperty(m_value_tree_fx.getPropertyName(i)), nullptr);
-			m_value_tree_fx.sendPropertyChangeMessage((m_value_tree_fx.getPropertyName(i)));
-		} else {
-			DBG("Didn't find non-audio property (fx) " + m_value_tree_fx.getPropertyName(i).toString().toStdString());
-		}
-	}
-	const ValueTree &lfo_tree = newStateMigrated.getChildWithName("lfo");
-	for (int i = 0; i < m_value_tree_lfo.getNumProperties(); ++i) {
-		if (lfo_tree.hasProperty(m_value_tree_lfo.getPropertyName(i))) {
-			m_value_tree_lfo.setProperty(m_value_tree_lfo.getPropertyName(i),
-			                             lfo_tree.getProperty(m_value_tree_lfo.getPropertyName(i)),
-			                             nullptr);
-			m_value_tree_lfo.sendPropertyChangeMessage((m_value_tree_lfo.getPropertyName(i)));
-		} else {
-			DBG("Didn't find non-audio property (lfo) " + m_value_tree_lfo.getPropertyName(i).toString().toStdString());
-		}
-	}
-	const ValueTree &misc_tree = newStateMigrated.getChildWithName("misc");
-	for (int i = 0; i < m_value_tree_misc.getNumProperties(); ++i) {
-		if (misc_tree.hasProperty(m_value_tree_misc.getPropertyName(i))) {
-			m_value_tree_misc.setProperty(m_value_tree_misc.getPropertyName(i),
-			                              misc_tree.getProperty(m_value_tree_misc.getPropertyName(i)),
-			                              nullptr);
-			m_value_tree_misc.sendPropertyChangeMessage((m_value_tree_misc.getPropertyName(i)));
-		} else {
-			DBG("Didn't find non-audio property (misc)" +
-			    m_value_tree_misc.getPropertyName(i).toString().toStdString());
-		}
-	}
-	const ValueTree &mod_tree = newStateMigrated.getChildWithName("mod");
-	for (int i = 0; i < m_value_tree_mod.getNumProperties(); ++i) {
-		if (mod_tree.hasProperty(m_value_tree_mod.getPropertyName(i))) {
-			m_value_tree_mod.setProperty(m_value_tree_mod.getPropertyName(i),
-			                             mod_tree.getProperty(m_value_tree_mod.getPropertyName(i)),
-			                             nullptr);
-			m_value_tree_mod.sendPropertyChangeMessage((m_value_tree_mod.getPropertyName(i)));
-		} else {
-			DBG("Didn't find non-audio property (mod) " + m_value_tree_mod.getPropertyName(i).toString().toStdString());
-		}
-	}
+	draw_changed |= applyPatchProperties(m_value_tree_draw, draw_tree, notify_all);
+	applyPatchProperties(m_value_tree_osc, newStateMigrated.getChildWithName("osc"), notify_all);
+	applyPatchProperties(m_value_tree_fx, newStateMigrated.getChildWithName("fx"), notify_all);
+	applyPatchProperties(m_value_tree_lfo, newStateMigrated.getChildWithName("lfo"), notify_all);
+	applyPatchProperties(m_value_tree_misc, newStateMigrated.getChildWithName("misc"), notify_all);
+	applyPatchProperties(m_value_tree_mod, newStateMigrated.getChildWithName("mod"), notify_all);
 
 	for (int i = 0; i < newStateMigrated.getNumChildren(); ++i) {
 		// all children which are an audio param have two properties (name and value)
@@ -145,10 +151,12 @@ void OdinAudioProcessor::readPatch(const ValueTree &newState) {
 
 			String name =
 			    newStateMigrated.getChild(i).getProperty(newStateMigrated.getChild(i).getPropertyName(0)).toString();
+			float value = newStateMigrated.getChild(i).getProperty(newStateMigrated.getChild(i).getPropertyName(1));
 
-			if (checkLoadParameter(name)) {
-				SETAUDIOFULLRANGESAFE(
-				    name, newStateMigrated.getChild(i).getProperty(newStateMigrated.getChild(i).getPropertyName(1)));
+			// unchanged params would still notify the host
+			auto *param = m_value_tree.getParameter(name);
+			if (checkLoadParameter(name) && (!param || param->convertTo0to1(value) != param->getValue())) {
+				SETAUDIOFULLRANGESAFE(name, value);
 			}
 			//DBG("Value on tree is now: is now:" + m_value_tree.getParameterAsValue(name).getValue().toString());
 
@@ -156,7 +164,72 @@ void OdinAudioProcessor::readPatch(const ValueTree &newState) {
 		}
 	}
 
-	setMonoPolyLegato(VALUETREETOPLAYMODE((int)m_value_tree.state.getChildWithName("misc")["legato"]));
+	m_patch_draw_changed |= draw_changed;
+}
+
+void OdinAudioProcessor::handOverPatch() {
+	const bool faded = m_patch_fading;
+	m_patch_fading   = false;
+	m_patch_pending  = false;
+	{
+		// the audio thread sees either the old or the new patch. Only the values which differed are handed over
+		const ScopedLock patch_lock(getCallbackLock());
+		m_mod_matrix.beginUpdate();
+		for (auto &change : m_pending_non_param_changes) {
+			(this->*change.handler)(change.tree, change.identifier);
+		}
+		setMonoPolyLegato(VALUETREETOPLAYMODE((int)m_value_tree.state.getChildWithName("misc")["legato"]));
+		// routing and rendered sources are rebuilt once for the whole patch
+		m_mod_matrix.endUpdate();
+		m_parameter_dispatcher.release();
+	}
+	m_pending_non_param_changes.clear();
+
+	if (m_patch_draw_changed) {
+		m_patch_draw_changed = false;
+		createDrawTablesFromValueTree();
+	}
+	// when fading the draw tables are built right away, so they are installed with the first block of the fade in
+	if (faded) {
+		m_WT_container.finishDrawTables();
+	}
+	m_patch_fader.fadeIn();
+}
+
+void OdinAudioProcessor::onNonParamChange(NonParamHandler p_handler,
+                                          ValueTree &p_tree,
+                                          const Identifier &p_identifier) {
+	if (!m_patch_pending) {
+		(this->*p_handler)(p_tree, p_identifier);
+		return;
+	}
+	// the handlers read the value from the tree, so a property only needs to be handed over once
+	for (auto &change : m_pending_non_param_changes) {
+		if (change.identifier == p_identifier && change.tree == p_tree) {
+			return;
+		}
+	}
+	m_pending_non_param_changes.push_back({p_handler, p_tree, p_identifier});
+}
+
+bool OdinAudioProcessor::applyPatchProperties(ValueTree &p_tree, const ValueTree &p_patch_tree, bool p_notify_all) {
+	bool changed = false;
+	for (int i = 0; i < p_tree.getNumProperties(); ++i) {
+		const Identifier name = p_tree.getPropertyName(i);
+		if (p_patch_tree.hasProperty(name)) {
+			// setProperty() only calls the listeners if the value differs
+			if (p_tree[name] != p_patch_tree[name]) {
+				p_tree.setProperty(name, p_patch_tree[name], nullptr);
+				changed = true;
+			} else if (p_notify_all) {
+				p_tree.sendPropertyChangeMessage(name);
+			}
+		} else if (!p_tree.hasType("draw")) {
+			DBG("Didn't find non-audio property (" + p_tree.getType().toString().toStdString() + ") " +
+			    name.toString().toStdString());
+		}
+	}
+	return changed;
 }
 
 bool OdinAudioProcessor::checkLoadParameter(const String &p_name) {
@@ -182,20 +255,20 @@ void OdinAudioProcessor::createDrawTablesFromValueTree() {
 			wavedraw_values[i] =
 			    (float)node[String("osc" + std::to_string(osc) + "_wavedraw_values_" + std::to_string(i))];
 		}
-		m_WT_container.createWavedrawTable(osc - 1, wavedraw_values, 44100);
+		m_WT_container.requestWavedrawTable(osc - 1, wavedraw_values, m_WT_container.getSampleRate());
 
 		// chipdraw
 		for (int i = 0; i < CHIPDRAW_STEPS_X; ++i) {
 			wavedraw_values[i] =
 			    (float)node[String("osc" + std::to_string(osc) + "_chipdraw_values_" + std::to_string(i))];
 		}
-		m_WT_container.createChipdrawTable(osc - 1, wavedraw_values, 44100);
+		m_WT_container.requestChipdrawTable(osc - 1, wavedraw_values, m_WT_container.getSampleRate());
 
 		// specdraw
 		for (int i = 0; i < SPECDRAW_STEPS_X; ++i) {
 			wavedraw_values[i] =
 			    (float)node[String("osc" + std::to_string(osc) + "_specdraw_values_" + std::to_string(i))];
 		}
-		m_WT_container.createSpecdrawTable(osc - 1, wavedraw_values, 44100);
+		m_WT_container.requestSpecdrawTable(osc - 1, wavedraw_values, m_WT_container.getSampleRate());
 	}
 }
\ No newline at end of file
@@ -0,0 +1,293 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+//this file is included from PluginProcessor.cpp to split the class implementation
+
+#include "PluginProcessor.h"
+#include <unordered_map>
+
+// The state handed to the host is a small binary format:
+//
+//   int32 ODIN_STATE_MAGIC, int32 format version
+//   int32 number of parameters, then per parameter the int32 hash of its ID and its value (not normalized)
+//   per osc and draw curve (wavedraw, chipdraw, specdraw) an int32 number of points and the points as floats
+//   int32 number of other trees (osc, fx, lfo, misc, mod, midi_learn), each written by ValueTree::writeToStream()
+//   the .scl and .kbm text of the tuning
+//
+// It is turned into the same tree the old XML state gave, so both go through readPatch() and the patch migration.
+// Parameters are looked up by the hash of their ID, so adding or reordering parameters doesn't break old states.
+#define ODIN_STATE_MAGIC 0x324e444f // "ODN2"
+#define ODIN_STATE_VERSION 1
+
+// FNV-1a, String::hashCode() isn't guaranteed to stay the same across JUCE versions
+static int hashParameterID(const String &p_id) {
+	uint32 hash = 2166136261u;
+	for (const char *character = p_id.toRawUTF8(); *character; ++character) {
+		hash = (hash ^ (uint8)*character) * 16777619u;
+	}
+	return (int)hash;
+}
+
+struct DrawCurve {
+	const char *name;
+	int number_of_points;
+};
+static const DrawCurve DRAW_CURVES[3] = {
+    {"wavedraw", WAVEDRAW_STEPS_X}, {"chipdraw", CHIPDRAW_STEPS_X}, {"specdraw", SPECDRAW_STEPS_X}};
+
+struct DrawIdentifiers {
+	std::vector<Identifier> curves[3][3];
+};
+
+// the property names of the draw tree, oscs counted from 0
+static const Identifier *getDrawIdentifiers(int p_osc, int p_curve) {
+	// creating an Identifier looks up the string pool, so they are only created once
+	static const DrawIdentifiers identifiers = []() {
+		DrawIdentifiers result;
+		for (int osc = 0; osc < 3; ++osc) {
+			for (int curve = 0; curve < 3; ++curve) {
+				for (int point = 0; point < DRAW_CURVES[curve].number_of_points; ++point) {
+					result.curves[osc][curve].push_back(Identifier(
+					    "osc" + String(osc + 1) + "_" + DRAW_CURVES[curve].name + "_values_" + String(point)));
+				}
+			}
+		}
+		return result;
+	}();
+	return identifiers.curves[p_osc][p_curve].data();
+}
+
+static void showNewerVersionWarning() {
+	AlertWindow::showMessageBox(
+	    AlertWindow::AlertIconType::WarningIcon,
+	    "You are trying to load a project which was saved with a newer Version of Odin2. Please go to "
+	    "www.thewavewarden.com and download the newest version to properly use this project!",
+	    "Thanks, I will!");
+}
+
+//==============================================================================
+void OdinAudioProcessor::getStateInformation(MemoryBlock &destData) {
+	// this is called when DAW saves a file
+	MemoryOutputStream stream(destData, false);
+	stream.writeInt(ODIN_STATE_MAGIC);
+	stream.writeInt(ODIN_STATE_VERSION);
+
+	// read from the parameters directly, copyState() would copy the whole tree first
+	const Array<AudioProcessorParameter *> &parameters = getParameters();
+	stream.writeInt(parameters.size());
+	for (auto *parameter : parameters) {
+		auto *ranged = static_cast<RangedAudioParameter *>(parameter);
+		stream.writeInt(hashParameterID(ranged->paramID));
+		stream.writeFloat(ranged->convertFrom0to1(ranged->getValue()));
+	}
+
+	for (int osc = 0; osc < 3; ++osc) {
+		for (int curve = 0; curve < 3; ++curve) {
+			const Identifier *identifiers = getDrawIdentifiers(osc, curve);
+			// readPatch() generates the curve if there is none
+			const int number_of_points =
+			    m_value_tree_draw.hasProperty(identifiers[0]) ? DRAW_CURVES[curve].number_of_points : 0;
+			stream.writeInt(number_of_points);
+			for (int point = 0; point < number_of_points; ++point) {
+				stream.writeFloat((float)m_value_tree_draw[identifiers[point]]);
+			}
+		}
+	}
+
+	const ValueTree &state = m_value_tree.state;
+	int number_of_trees    = 0;
+	for (const auto &child : state) {
+		number_of_trees += !child.hasType("PARAM") && child != m_value_tree_draw;
+	}
+	stream.writeInt(number_of_trees);
+	for (const auto &child : state) {
+		if (!child.hasType("PARAM") && child != m_value_tree_draw) {
+			child.writeToStream(stream);
+		}
+	}
+
+	stream.writeString(String(m_tuning.scale.rawText));
+	stream.writeString(String(m_tuning.keyboardMapping.rawText));
+}
+
+// returns an invalid tree if the data is broken
+ValueTree OdinAudioProcessor::readBinaryState(const void *p_data, int p_size, String &p_scl, String &p_kbm) {
+	MemoryInputStream stream(p_data, (size_t)p_size, false);
+	stream.readInt(); // magic
+	stream.readInt(); // version, there is only one so far
+
+	// all instances have the same parameters
+	static const std::unordered_map<int, String> parameter_ids = [this]() {
+		std::unordered_map<int, String> result;
+		for (auto *parameter : getParameters()) {
+			const String &id = static_cast<RangedAudioParameter *>(parameter)->paramID;
+			jassert(result.find(hashParameterID(id)) == result.end()); // two IDs have the same hash
+			result[hashParameterID(id)] = id;
+		}
+		return result;
+	}();
+
+	ValueTree state(m_value_tree.state.getType());
+
+	const int number_of_parameters = stream.readInt();
+	if (number_of_parameters < 0 || (int64)number_of_parameters * 8 > stream.getNumBytesRemaining()) {
+		return {};
+	}
+	for (int index = 0; index < number_of_parameters; ++index) {
+		const int hash    = stream.readInt();
+		const float value = stream.readFloat();
+		// parameters which were removed since the state was saved are skipped
+		auto id = parameter_ids.find(hash);
+		if (id != parameter_ids.end()) {
+			ValueTree parameter("PARAM");
+			parameter.setProperty("id", id->second, nullptr);
+			parameter.setProperty("value", value, nullptr);
+			state.appendChild(parameter, nullptr);
+		}
+	}
+
+	ValueTree draw("draw");
+	for (int osc = 0; osc < 3; ++osc) {
+		for (int curve = 0; curve < 3; ++curve) {
+			const int number_of_points = stream.readInt();
+			if (number_of_points < 0 || (int64)number_of_points * 4 > stream.getNumBytesRemaining()) {
+				return {};
+			}
+			const Identifier *identifiers = getDrawIdentifiers(osc, curve);
+			for (int point = 0; point < number_of_points; ++point) {
+				const float value = stream.readFloat();
+				if (point < DRAW_CURVES[curve].number_of_points) {
+					draw.setProperty(identifiers[point], value, nullptr);
+				}
+			}
+		}
+	}
+	state.appendChild(draw, nullptr);
+
+	const int number_of_trees = stream.readInt();
+	for (int index = 0; index < number_of_trees; ++index) {
+		ValueTree child = ValueTree::readFromStream(stream);
+		if (!child.isValid()) {
+			return {};
+		}
+		state.appendChild(child, nullptr);
+	}
+
+	p_scl = stream.readString();
+	p_kbm = stream.readString();
+	return state;
+}
+
+// states saved before the binary format, returns an invalid tree if the data isn't a state
+ValueTree OdinAudioProcessor::readXmlState(const void *p_data, int p_size, String &p_scl, String &p_kbm) {
+	std::unique_ptr<XmlElement> xmlState(getXmlFromBinary(p_data, p_size));
+	if (xmlState.get() == nullptr) {
+		return {};
+	}
+
+	//read tunings and remove them from xmltree:
+	for (auto *child : xmlState->getChildIterator()) {
+		if (child->hasTagName("tuning_scl")) {
+			p_scl = child->getStringAttribute("data");
+		}
+		if (child->hasTagName("tuning_kbm")) {
+			p_kbm = child->getStringAttribute("data");
+		}
+	}
+	xmlState->deleteAllChildElementsWithTagName("tuning_kbm");
+	xmlState->deleteAllChildElementsWithTagName("tuning_scl");
+	jassert(xmlState->getChildByName("tuning_kbm") == nullptr);
+	jassert(xmlState->getChildByName("tuning_scl") == nullptr);
+
+	return ValueTree::fromXml(*xmlState);
+}
+
+//this is called when DAW restores a file
+void OdinAudioProcessor::setStateInformation(const void *data, int sizeInBytes) {
+
+	// disable for standalone plugins
+	if (wrapperType == wrapperType_Standalone) {
+		return;
+	}
+
+	String scl_text;
+	String kbm_text;
+	ValueTree state;
+	MemoryInputStream header(data, (size_t)sizeInBytes, false);
+	if (sizeInBytes >= 8 && header.readInt() == ODIN_STATE_MAGIC) {
+		if (header.readInt() > ODIN_STATE_VERSION) {
+			showNewerVersionWarning();
+			return;
+		}
+		state = readBinaryState(data, sizeInBytes, scl_text, kbm_text);
+	} else {
+		state = readXmlState(data, sizeInBytes, scl_text, kbm_text);
+	}
+	if (!state.isValid()) {
+		return;
+	}
+
+	Tunings::Scale scl           = Tunings::evenTemperament12NoteScale();
+	Tunings::KeyboardMapping kbm = Tunings::tuneNoteTo(60, Tunings::MIDI_0_FREQ * 32.0);
+	if (scl_text.isNotEmpty()) {
+		try {
+			scl = Tunings::parseSCLData(scl_text.toStdString());
+		} catch (...) {
+			DBG("Failed to load .scl from binary state... resorting to default");
+			scl = Tunings::evenTemperament12NoteScale();
+		}
+	}
+	if (kbm_text.isNotEmpty()) {
+		try {
+			kbm = Tunings::parseKBMData(kbm_text.toStdString());
+		} catch (...) {
+			DBG("Failed to load .kbm from binary state... resorting to default");
+			kbm = Tunings::tuneNoteTo(60, Tunings::MIDI_0_FREQ * 32.0);
+		}
+	}
+	setTuning(Tunings::Tuning(scl, kbm));
+
+	if (state.hasType(m_value_tree.state.getType())) {
+
+		//avoid reading from newer patch versions
+		int patch_migration_version_read = state.getChildWithName("misc")["patch_migration_version"];
+		if (patch_migration_version_read > ODIN_PATCH_MIGRATION_VERSION) {
+			showNewerVersionWarning();
+			return;
+		}
+
+		//load data
+		readPatch(state);
+
+		//set the correct version since an old one was maybe set from patch
+		m_value_tree.state.getChildWithName("misc").setProperty("version_minor", ODIN_MINOR_VERSION, nullptr);
+		m_value_tree.state.getChildWithName("misc").setProperty("version_patch", ODIN_PATCH_VERSION, nullptr);
+		m_value_tree.state.getChildWithName("misc").setProperty(
+		    "patch_migration_version", ODIN_PATCH_MIGRATION_VERSION, nullptr);
+
+		m_force_values_onto_gui = true;
+
+		//create midi learn map from valuetree
+		for (int i = 0; i < m_value_tree_midi_learn.getNumProperties(); ++i) {
+			m_midi_control_param_map.emplace(
+			    (int)m_value_tree_midi_learn[m_value_tree_midi_learn.getPropertyName(i)],
+			    m_value_tree.getParameter(m_value_tree_midi_learn.getPropertyName(i)));
+		}
+
+		if (m_editor_pointer) {
+			m_editor_pointer->forceValueTreeOntoComponents(false);
+		}
+	}
+}
@@ -65,7 +65,12 @@ public:
   inline void incLFO() {
     float increment_modded = m_LFO_inc;
     if (*m_freq_mod) {
-      increment_modded *= pow(4, *m_freq_mod * 2);
+      // the modulation only changes once per sub-block at most
+      if (*m_freq_mod != m_freq_mod_last) {
+        m_freq_mod_last = *m_freq_mod;
+        m_freq_mod_factor = pow(4, m_freq_mod_last * 2);
+      }
+      increment_modded *= m_freq_mod_factor;
     }
     m_LFO_pos += increment_modded;
     while (m_LFO_pos > 2.f) {
@@ -134,6 +139,8 @@ protected:
   float m_synctime_ratio = 3.f / 16.f;
 
   float *m_freq_mod;
+  float m_freq_mod_last = 0.f;
+  float m_freq_mod_factor = 1.f;
   float *m_amount_mod;
   float *m_drywet_mod;
   float *m_feedback_mod;
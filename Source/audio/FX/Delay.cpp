@@ -37,7 +37,11 @@ float Delay::doDelayLeft(float p_left) {
 
 	float delay_time_modded = m_delay_time_smooth;
 	if (*m_time_mod) {
-		delay_time_modded *= pow(3, *m_time_mod);
+		if (*m_time_mod != m_time_mod_last) {
+			m_time_mod_last   = *m_time_mod;
+			m_time_mod_factor = pow(3, m_time_mod_last);
+		}
+		delay_time_modded *= m_time_mod_factor;
 	}
 
 	m_highpass_left.update(); // needs to be done only for modding later
@@ -95,7 +99,8 @@ float Delay::doDelayRight(float p_right) {
 
 	float delay_time_modded = m_delay_time_smooth;
 	if (*m_time_mod) {
-		delay_time_modded *= pow(3, *m_time_mod);
+		// factor was updated in doDelayLeft()
+		delay_time_modded *= m_time_mod_factor;
 	}
 
 	m_highpass_right.update(); // needs to be done only for modding later
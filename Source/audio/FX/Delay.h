@@ -21,6 +21,7 @@
 
 //#include <memory>
 #include <cstring>
+#include <limits>
 
 #define CIRCULAR_BUFFER_LENGTH (MAX_EXPECTED_SAMPLE_RATE * MAX_DELAY_TIME)
 #define MOVING_AVERAGE_SAMPLE_LENGTH 441 // 1/100 s at standard smaple rate
@@ -126,6 +127,20 @@ public:
     m_ping_pong = p_ping_pong;
   }
 
+  // longest gap between two echoes, time modulation scales by up to 3
+  float getMaxDelayTime() const { return m_delay_time_control * 3.f; }
+
+  // time for the echoes to decay by 60dB after the input stopped
+  float getTailSeconds() const {
+    if (m_feedback >= 1.f) {
+      return std::numeric_limits<float>::infinity();
+    }
+    if (m_feedback <= 0.001f) {
+      return getMaxDelayTime();
+    }
+    return getMaxDelayTime() * (1.f + log(0.001f) / log(m_feedback));
+  }
+
 protected:
   DCBlockingFilter m_DC_blocking_filter_left;
   DCBlockingFilter m_DC_blocking_filter_right;
@@ -135,6 +150,9 @@ protected:
   float m_synctime_ratio = 3.f / 16.f;
 
   float *m_time_mod;
+  // pow(3, time mod), only recalculated when the modulation changes
+  float m_time_mod_last = 0.f;
+  float m_time_mod_factor = 1.f;
   float *m_feedback_mod;
   float *m_dry_mod;
   float *m_wet_mod;
@@ -85,6 +85,8 @@ protected:
   float m_synctime_ratio = 3.f / 16.f;
 
   float *m_freq_mod;
+  float m_freq_mod_last = 0.f;
+  float m_freq_mod_factor = 1.f;
   float *m_amount_mod;
   float *m_drywet_mod;
   float *m_feedback_mod;
@@ -94,8 +96,12 @@ protected:
   inline void incrementLFO() {
     float increment_modded = m_increment_sine;
     if (*m_freq_mod) {
-      //factor 1 / 16 to 16
-      increment_modded *= pow(4, *m_freq_mod * 2);
+      //factor 1 / 16 to 16, only recalculated when the modulation changes
+      if (*m_freq_mod != m_freq_mod_last) {
+        m_freq_mod_last = *m_freq_mod;
+        m_freq_mod_factor = pow(4, m_freq_mod_last * 2);
+      }
+      increment_modded *= m_freq_mod_factor;
     }
     m_index_sine += increment_modded;
     while (m_index_sine > 1) {
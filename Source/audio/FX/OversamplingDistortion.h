@@ -15,6 +15,8 @@
 
 #pragma once
 
+#include "../Filters/Oversampler.h"
+
 #define THRESHOLD_MIN 0.05f
 #define DISTORTION_OUTPUT_SCALAR 1.0
 
@@ -25,7 +27,14 @@ public:
 
   enum DistortionAlgorithm { Clamp = 1, Fold = 2, Zero = 3, Sine = 4, Cube = 5};
 
-  double doDistortion(double p_input);
+  // distorts p_num_samples in place
+  void doDistortion(float *p_buffer, int p_num_samples);
+
+  void setOversampling(int p_factor, Oversampler::Quality p_quality) {
+    m_oversampler.setup(p_factor, p_quality);
+  }
+  // in samples, reported to the host while the distortion is on
+  float getLatency() const { return m_oversampler.getLatency(); }
 
   inline void setThreshold(float p_threshold) {
     p_threshold = 1.f - p_threshold;
@@ -49,9 +58,7 @@ public:
   void setDryWetModPointer(float *p_pointer) { m_drywet_mod = p_pointer; }
 
   void reset() {
-    for (int i = 0; i < 10; ++i) {
-      xv[i] = yv[i] = 0;
-    }
+    m_oversampler.reset();
     m_threshold_smooth = m_threshold;
   }
 
@@ -62,15 +69,10 @@ protected:
   // bool m_is_overdrive = true; // else fuzz
   DistortionAlgorithm m_algorithm = Clamp;
 
-  double m_last_input = 0.f;
   float m_bias = 0.f;
   float m_threshold = 0.343f;        //(1-0.3)^3
   float m_threshold_smooth = 0.343f; //(1-0.3)^3
   float m_drywet = 1.f;
 
-  // IIR Filter buffers for downsampling
-  // coefficients (see implementation) are taken from
-  // http://www-users.cs.york.ac.uk/~fisher/cgi-bin/mkfscript
-  double xv[10] = {0.};
-  double yv[10] = {0.};
+  Oversampler m_oversampler;
 };
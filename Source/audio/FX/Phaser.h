@@ -141,6 +141,8 @@ protected:
   float m_synctime_ratio = 3.f / 16.f;
 
   float *m_rate_mod;
+  float m_rate_mod_last = 0.f;
+  float m_rate_mod_factor = 1.f;
   float *m_drywet_mod;
   float *m_amount_mod;
   float *m_freq_mod;
@@ -150,10 +152,19 @@ protected:
 
   bool m_LFO_freq_set = false;
 
+  // pow(4, rate mod), only recalculated when the modulation changes, which is once per sub-block at most
+  inline float getRateModFactor() {
+    if (*m_rate_mod != m_rate_mod_last) {
+      m_rate_mod_last = *m_rate_mod;
+      m_rate_mod_factor = pow(4, m_rate_mod_last);
+    }
+    return m_rate_mod_factor;
+  }
+
   inline void incrementLFOLeft() {
     float increment_modded = m_increment_sine;
     if (*m_rate_mod) {
-      increment_modded *= pow(4, *m_rate_mod);
+      increment_modded *= getRateModFactor();
     }
     m_index_sine_left += increment_modded;
     while (m_index_sine_left > 1) {
@@ -166,7 +177,8 @@ protected:
     float increment_modded = m_increment_sine;
     if (*m_rate_mod) {
       //factor 1/16 to 16
-      increment_modded *= pow(4, *m_rate_mod * 2);
+      const float factor = getRateModFactor();
+      increment_modded *= factor * factor;
     }
     m_index_sine_right += increment_modded;
     while (m_index_sine_right > 1) {
@@ -37,7 +37,7 @@ public:
   }
 
   float m_kbd_mod_amount = 0;
-  int m_MIDI_note = 0;
+  float m_MIDI_note = 0; // tuned, so it can be fractional
   float m_env_value = 0;
   float m_env_mod_amount = 0;
   int m_MIDI_velocity = 0;
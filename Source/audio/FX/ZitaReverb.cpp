@@ -17,6 +17,7 @@
 // https://github.com/royvegard/zita-rev1 for the original code.
 
 #include "ZitaReverb.h"
+#include <algorithm>
 #include <math.h>
 #include <stdio.h>
 #include <string.h>
@@ -279,6 +280,9 @@ void ZitaReverb::prepare() {
 }
 
 void ZitaReverb::process(float input[2]) {
+	if (_Adirty || _Bdirty || _Cdirty) {
+		prepare();
+	}
 
 	int i, n;
 	float *p0, *p1;
@@ -385,25 +389,179 @@ void ZitaReverb::process(float input[2]) {
 	input[1] = out[1];
 }
 
+void ZitaReverb::processBlock(float *p_left, float *p_right, int p_num_samples) {
+	jassert(_vdelay0._size > 0);
+
+	// not worth the overhead for a few samples, e.g. when audio rate modulation forces single sample sub-blocks
+	if (p_num_samples < REVERB_MIN_BLOCK) {
+		for (int sample = 0; sample < p_num_samples; ++sample) {
+			float stereo_signal[2] = {p_left[sample], p_right[sample]};
+			process(stereo_signal);
+			p_left[sample]  = stereo_signal[0];
+			p_right[sample] = stereo_signal[1];
+		}
+		return;
+	}
+
+	// the setters only mark what changed, recalculate once per block
+	if (_Adirty || _Bdirty || _Cdirty) {
+		prepare();
+	}
+
+	//g = sqrtf(0.125f);
+	const float g = 0.35355f;
+
+	// the first four lines get the left input, the last four the right one. Half of them subtract it
+	const float input_sign[REVERB_LINES] = {1.f, 1.f, -1.f, -1.f, 1.f, 1.f, -1.f, -1.f};
+
+	// state of the damping filters as lanes, so the lane loop below can be vectorized
+	float gmf[REVERB_LINES], glo[REVERB_LINES], wlo[REVERB_LINES], whi[REVERB_LINES];
+	float slo[REVERB_LINES], shi[REVERB_LINES];
+	for (int lane = 0; lane < REVERB_LINES; ++lane) {
+		gmf[lane] = _filt1[lane]._gmf;
+		glo[lane] = _filt1[lane]._glo;
+		wlo[lane] = _filt1[lane]._wlo;
+		whi[lane] = _filt1[lane]._whi;
+		slo[lane] = _filt1[lane]._slo;
+		shi[lane] = _filt1[lane]._shi;
+	}
+
+	int start = 0;
+	while (start < p_num_samples) {
+		// longest run in which no line wraps around, so the loops don't need to check the indices.
+		// Within a run every slot of a line is read once before it is overwritten, so nothing written during
+		// a run is read in the same run. That's why the diffusers and the mixing can be done for the whole run.
+		int run = std::min(p_num_samples - start, REVERB_MAX_RUN);
+		run     = std::min(run, _vdelay0._size - _vdelay0._ir);
+		run     = std::min(run, _vdelay0._size - _vdelay0._iw);
+		run     = std::min(run, _vdelay1._size - _vdelay1._ir);
+		run     = std::min(run, _vdelay1._size - _vdelay1._iw);
+		for (int lane = 0; lane < REVERB_LINES; ++lane) {
+			run = std::min(run, _diff1[lane]._size - _diff1[lane]._i);
+			run = std::min(run, _delay[lane]._size - _delay[lane]._i);
+		}
+		float *left  = p_left + start;
+		float *right = p_right + start;
+
+		// the predelay can be shorter than a run, so write and read sample by sample
+		float t[2][REVERB_MAX_RUN];
+		{
+			const float *vdelay0_read = _vdelay0._line + _vdelay0._ir;
+			const float *vdelay1_read = _vdelay1._line + _vdelay1._ir;
+			float *vdelay0_write      = _vdelay0._line + _vdelay0._iw;
+			float *vdelay1_write      = _vdelay1._line + _vdelay1._iw;
+			for (int sample = 0; sample < run; ++sample) {
+				vdelay0_write[sample] = left[sample];
+				vdelay1_write[sample] = right[sample];
+				t[0][sample]          = 0.3f * vdelay0_read[sample];
+				t[1][sample]          = 0.3f * vdelay1_read[sample];
+			}
+		}
+
+		// allpass diffusers
+		float x[REVERB_LINES][REVERB_MAX_RUN];
+		for (int lane = 0; lane < REVERB_LINES; ++lane) {
+			const float *delay_line = _delay[lane]._line + _delay[lane]._i;
+			float *diff_line        = _diff1[lane]._line + _diff1[lane]._i;
+			const float *input      = t[lane / 4];
+			const float sign        = input_sign[lane];
+			const float c           = _diff1[lane]._c;
+			for (int sample = 0; sample < run; ++sample) {
+				const float z     = diff_line[sample];
+				const float in    = delay_line[sample] + sign * input[sample] - c * z;
+				diff_line[sample] = in;
+				x[lane][sample]   = z + c * in;
+			}
+		}
+
+		// 8 point hadamard mixing matrix
+		for (int stride = 1; stride < REVERB_LINES; stride *= 2) {
+			for (int lane = 0; lane < REVERB_LINES; ++lane) {
+				if (lane & stride) {
+					continue;
+				}
+				float *low  = x[lane];
+				float *high = x[lane + stride];
+				for (int sample = 0; sample < run; ++sample) {
+					const float sum = low[sample] + high[sample];
+					high[sample]    = low[sample] - high[sample];
+					low[sample]     = sum;
+				}
+			}
+		}
+
+		// damping filters. These are recursive, so the lanes are the inner loop here and the samples are
+		// transposed to be lane-contiguous
+		float lanes[REVERB_MAX_RUN][REVERB_LINES];
+		for (int lane = 0; lane < REVERB_LINES; ++lane) {
+			for (int sample = 0; sample < run; ++sample) {
+				lanes[sample][lane] = x[lane][sample];
+			}
+		}
+		for (int sample = 0; sample < run; ++sample) {
+			float *y = lanes[sample];
+			for (int lane = 0; lane < REVERB_LINES; ++lane) {
+				float in = g * y[lane];
+				slo[lane] += wlo[lane] * (in - slo[lane]) + 1e-10f;
+				in += glo[lane] * slo[lane];
+				shi[lane] += whi[lane] * (in - shi[lane]);
+				y[lane] = gmf[lane] * shi[lane];
+			}
+		}
+		for (int lane = 0; lane < REVERB_LINES; ++lane) {
+			float *delay_line = _delay[lane]._line + _delay[lane]._i;
+			for (int sample = 0; sample < run; ++sample) {
+				delay_line[sample] = lanes[sample][lane];
+			}
+		}
+
+		for (int sample = 0; sample < run; ++sample) {
+			const float wet_left  = _g1 * (x[1][sample] + x[2][sample]);
+			const float wet_right = _g1 * (x[1][sample] - x[2][sample]);
+			left[sample]          = (float)_pareq[0].doFilter(wet_left) + _g0 * left[sample];
+			right[sample]         = (float)_pareq[1].doFilter(wet_right) + _g0 * right[sample];
+		}
+
+		// wrap once per run instead of once per sample and line
+		auto advance = [run](int &index, int size) {
+			index += run;
+			if (index == size) {
+				index = 0;
+			}
+		};
+		advance(_vdelay0._ir, _vdelay0._size);
+		advance(_vdelay0._iw, _vdelay0._size);
+		advance(_vdelay1._ir, _vdelay1._size);
+		advance(_vdelay1._iw, _vdelay1._size);
+		for (int lane = 0; lane < REVERB_LINES; ++lane) {
+			advance(_diff1[lane]._i, _diff1[lane]._size);
+			advance(_delay[lane]._i, _delay[lane]._size);
+		}
+		start += run;
+	}
+
+	for (int lane = 0; lane < REVERB_LINES; ++lane) {
+		_filt1[lane]._slo = slo[lane];
+		_filt1[lane]._shi = shi[lane];
+	}
+}
+
 void ZitaReverb::set_delay(float v) {
 	_ipdel = v;
 	//_cntA1++;
 	_Adirty = true;
-	prepare();
 }
 
 void ZitaReverb::set_xover(float v) {
 	_xover = v;
 	//_cntB1++;
 	_Bdirty = true;
-	prepare();
 }
 
 void ZitaReverb::set_rtlow(float v) {
 	_rtlow = v;
 	//_cntB1++;
 	_Cdirty = true;
-	prepare();
 }
 
 void ZitaReverb::set_rtmid(float v) {
@@ -412,28 +570,24 @@ void ZitaReverb::set_rtmid(float v) {
 	//_cntC1++;
 	_Bdirty = true;
 	_Cdirty = true;
-	prepare();
 }
 
 void ZitaReverb::set_fdamp(float v) {
 	_fdamp = v;
 	//_cntB1++;
 	_Bdirty = true;
-	prepare();
 }
 
 void ZitaReverb::set_opmix(float v) {
 	_opmix = v;
 	//_cntC1++;
 	_Cdirty = true;
-	prepare();
 }
 
 void ZitaReverb::set_rgxyz(float v) {
 	_rgxyz = v;
 	//_cntC1++;
 	_Cdirty = true;
-	prepare();
 }
 
 void ZitaReverb::set_eq1(float f, float g) {
@@ -443,21 +597,18 @@ void ZitaReverb::set_eq1(float f, float g) {
 	_pareq[1].setFreq(f);
 	_pareq[0].setQ(g);
 	_pareq[1].setQ(g);
-	prepare();
 }
 
 void ZitaReverb::set_eq1_gain(float g) {
 	//_eq_gain = g;
 	_pareq[0].setGain(g);
 	_pareq[1].setGain(g);
-	prepare();
 }
 
 void ZitaReverb::set_eq1_freq(float f) {
 	//_eq_freq = f;
 	_pareq[0].setFreq(f);
 	_pareq[1].setFreq(f);
-	prepare();
 }
 
 void ZitaReverb::set_ducking(float d) {
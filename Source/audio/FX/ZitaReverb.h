@@ -20,6 +20,9 @@
 #define __REVERB_H
 
 #define REVERB_EQ_Q_DEFAULT 0.9f
+#define REVERB_LINES 8 // delay lines of the feedback delay network
+#define REVERB_MAX_RUN 64 // max samples processBlock() renders between two wrap checks
+#define REVERB_MIN_BLOCK 16 // shorter blocks are processed sample by sample
 
 //#include "ParametricEQ.h"
 #include "../Filters/BiquadEQ.h"
@@ -165,6 +168,8 @@ public:
 
 	void prepare();
 	void process(float input[2]);
+	// processes the stereo signal in place
+	void processBlock(float *p_left, float *p_right, int p_num_samples);
 	void reset();
 
 	void set_delay(float v);  //v in seconds
@@ -179,14 +184,24 @@ public:
 	void set_eq1_freq(float f);
 	void set_ducking(float d); //unused?
 
+	// longest time the output can stay silent while the reverb still holds signal: predelay plus the longest
+	// diffuser and delay line of the feedback loop
+	float getMaxDelayTime() const {
+		return _ipdel + 0.3f;
+	}
+	// time for the reverb to decay by 60dB after the input stopped
+	float getTailSeconds() const {
+		return _ipdel + (_rtlow > _rtmid ? _rtlow : _rtmid);
+	}
+
 private:
 	float _fsamp;
 
 	Vdelay _vdelay0;
 	Vdelay _vdelay1;
-	Diff1 _diff1[8];
-	Filt1 _filt1[8];
-	RevDelay _delay[8];
+	Diff1 _diff1[REVERB_LINES];
+	Filt1 _filt1[REVERB_LINES];
+	RevDelay _delay[REVERB_LINES];
 
 	//basically a "set-dirty" mechanism ?
 	// volatile int _cntA1;
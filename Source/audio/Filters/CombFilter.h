@@ -32,7 +32,7 @@ public:
 	virtual ~CombFilter();
 
 	float doFilter(float p_input);
-	int m_MIDI_note     = 0;
+	float m_MIDI_note   = 0; // tuned, so it can be fractional
 	int m_MIDI_velocity = 0.f;
 
 	float m_kbd_mod_amount = 0;
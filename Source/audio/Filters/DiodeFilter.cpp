@@ -60,16 +60,14 @@ void DiodeFilter::update() {
 	}
 	m_last_freq_modded = m_freq_modded;
 
-	//calc alphas
-	double wd = 2 * 3.141592653 * m_freq_modded;
-	//double t = 1.0 / m_samplerate;
-	double wa = (2.0 * m_samplerate) * juce::dsp::FastMathApproximations::tan(wd * m_one_over_samplerate * 0.5);
-	double g  = wa * m_one_over_samplerate / 2.0;
-
-	double G4 = 0.5 * g / (1.0 + g);
-	double G3 = 0.5 * g / (1.0 + g - 0.5 * g * G4);
-	double G2 = 0.5 * g / (1.0 + g - 0.5 * g * G3);
-	double G1 = g / (1.0 + g - g * G2);
+	//calc alphas, the coupled stages come from the table as well
+	const DiodeFilterCoefficients diode = m_coefficient_table->getDiodeCoefficients(m_pitch_modded);
+	double g = m_coefficients.g;
+
+	double G4 = diode.G4;
+	double G3 = diode.G3;
+	double G2 = diode.G2;
+	double G1 = diode.G1;
 	m_gamma   = G4 * G3 * G2 * G1;
 
 	m_sg1 = G4 * G3 * G2;
@@ -77,17 +75,17 @@ void DiodeFilter::update() {
 	m_sg3 = G4;
 	m_sg4 = 1.0;
 
-	double G = g / (1.0 + g);
+	double G = m_coefficients.G;
 
 	m_LPF1.m_alpha = G;
 	m_LPF2.m_alpha = G;
 	m_LPF3.m_alpha = G;
 	m_LPF4.m_alpha = G;
 
-	m_LPF1.m_beta = 1.0 / (1.0 + g - g * G2);
-	m_LPF2.m_beta = 1.0 / (1.0 + g - 0.5 * g * G3);
-	m_LPF3.m_beta = 1.0 / (1.0 + g - 0.5 * g * G4);
-	m_LPF4.m_beta = 1.0 / (1.0 + g);
+	m_LPF1.m_beta = diode.beta1;
+	m_LPF2.m_beta = diode.beta2;
+	m_LPF3.m_beta = diode.beta3;
+	m_LPF4.m_beta = m_coefficients.one_over_1_p_g;
 
 	m_LPF1.m_delta = g;
 	m_LPF2.m_delta = 0.5 * g;
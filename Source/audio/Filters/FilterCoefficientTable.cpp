@@ -0,0 +1,62 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#include "FilterCoefficientTable.h"
+#include <map>
+#include <memory>
+#include <mutex>
+
+const FilterCoefficientTable &FilterCoefficientTable::getTable(double p_samplerate) {
+	// one table per sample rate, they are small and never freed so filters can keep pointers to them
+	static std::mutex mutex;
+	static std::map<double, std::unique_ptr<FilterCoefficientTable>> tables;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	auto &table = tables[p_samplerate];
+	if (!table) {
+		table.reset(new FilterCoefficientTable(p_samplerate));
+	}
+	return *table;
+}
+
+FilterCoefficientTable::FilterCoefficientTable(double p_samplerate) {
+	const double pi = MathConstants<double>::pi;
+	for (int index = 0; index < FILTER_TABLE_SIZE; ++index) {
+		const double pitch     = (double)index / FILTER_TABLE_STEPS_PER_SEMITONE;
+		const double frequency = FILTER_TABLE_MIN_FREQ * pow(2., pitch / 12.);
+
+		// prewarp for BZT, keep away from the pole of tan at low sample rates
+		const double g = tan(jmin(pi * frequency / p_samplerate, 0.49 * pi));
+
+		m_coefficients[index].frequency      = (float)frequency;
+		m_coefficients[index].g              = (float)g;
+		m_coefficients[index].G              = (float)(g / (1.0 + g));
+		m_coefficients[index].one_over_1_p_g = (float)(1.0 / (1.0 + g));
+
+		// diode ladder stages from the last to the first
+		const double G4 = 0.5 * g / (1.0 + g);
+		const double G3 = 0.5 * g / (1.0 + g - 0.5 * g * G4);
+		const double G2 = 0.5 * g / (1.0 + g - 0.5 * g * G3);
+		const double G1 = g / (1.0 + g - g * G2);
+
+		m_diode_coefficients[index].G1    = (float)G1;
+		m_diode_coefficients[index].G2    = (float)G2;
+		m_diode_coefficients[index].G3    = (float)G3;
+		m_diode_coefficients[index].G4    = (float)G4;
+		m_diode_coefficients[index].beta1 = (float)(1.0 / (1.0 + g - g * G2));
+		m_diode_coefficients[index].beta2 = (float)(1.0 / (1.0 + g - 0.5 * g * G3));
+		m_diode_coefficients[index].beta3 = (float)(1.0 / (1.0 + g - 0.5 * g * G4));
+	}
+}
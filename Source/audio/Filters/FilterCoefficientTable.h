@@ -0,0 +1,116 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#pragma once
+
+#include "../../GlobalIncludes.h"
+#include <cstdint>
+#include <cstring>
+
+#define FILTER_TABLE_MIN_FREQ 20.f // FILTER_FC_MIN
+#define FILTER_TABLE_PITCH_RANGE 119.589417f // semitones from FILTER_FC_MIN to FILTER_FC_MAX
+#define FILTER_TABLE_STEPS_PER_SEMITONE 8
+#define FILTER_TABLE_SIZE ((int)(FILTER_TABLE_PITCH_RANGE * FILTER_TABLE_STEPS_PER_SEMITONE) + 2)
+
+// coefficients of the bilinear transformed VA one pole, see Will Pirkles book
+struct FilterCoefficients {
+	float frequency;      // cutoff in Hz
+	float g;              // prewarped integrator gain tan(pi * fc / fs)
+	float G;              // g / (1 + g), the feed forward coeff of the one pole
+	float one_over_1_p_g; // 1 / (1 + g)
+};
+
+// the diode ladder has coupled stages and needs a few more
+struct DiodeFilterCoefficients {
+	float G1;
+	float G2;
+	float G3;
+	float G4;
+	float beta1;
+	float beta2;
+	float beta3;
+};
+
+// Filter coefficients over cutoff pitch for one sample rate. The pitch is in semitones above 20Hz, which is what
+// the filter modulation produces anyway, so modulating the cutoff costs a table lookup instead of exp and tan.
+// Tables are shared by all filters running at the same sample rate.
+class FilterCoefficientTable {
+public:
+	// builds the table for the sample rate on first use, don't call this from the audio thread
+	static const FilterCoefficientTable &getTable(double p_samplerate);
+
+	// the cutoff smoother moves the frequency every sample, so this avoids log2(). The octave comes from the float
+	// exponent and a polynomial of the mantissa does the rest, within 0.002 semitones and continuous across octaves
+	static float frequencyToPitch(double p_frequency) {
+		if (p_frequency <= FILTER_TABLE_MIN_FREQ) {
+			return 0.f;
+		}
+		float ratio = (float)p_frequency * (1.f / FILTER_TABLE_MIN_FREQ);
+		int32_t bits;
+		memcpy(&bits, &ratio, sizeof(bits));
+		const float octave = (float)((bits >> 23) - 127);
+		bits               = (bits & 0x007fffff) | 0x3f800000;
+		float mantissa;
+		memcpy(&mantissa, &bits, sizeof(mantissa));
+
+		// log2(1 + x) for x in [0, 1), the coefficients sum up to 1
+		const float x = mantissa - 1.f;
+		return 12.f * (octave + x * (1.43807325f + x * (-0.674766663f + x * (0.317000721f + x * -0.0803073039f))));
+	}
+
+	inline FilterCoefficients getCoefficients(float p_pitch) const {
+		int index;
+		float frac;
+		getPosition(p_pitch, index, frac);
+		const FilterCoefficients &low  = m_coefficients[index];
+		const FilterCoefficients &high = m_coefficients[index + 1];
+		return {low.frequency + frac * (high.frequency - low.frequency),
+		        low.g + frac * (high.g - low.g),
+		        low.G + frac * (high.G - low.G),
+		        low.one_over_1_p_g + frac * (high.one_over_1_p_g - low.one_over_1_p_g)};
+	}
+
+	inline DiodeFilterCoefficients getDiodeCoefficients(float p_pitch) const {
+		int index;
+		float frac;
+		getPosition(p_pitch, index, frac);
+		const DiodeFilterCoefficients &low  = m_diode_coefficients[index];
+		const DiodeFilterCoefficients &high = m_diode_coefficients[index + 1];
+		return {low.G1 + frac * (high.G1 - low.G1),
+		        low.G2 + frac * (high.G2 - low.G2),
+		        low.G3 + frac * (high.G3 - low.G3),
+		        low.G4 + frac * (high.G4 - low.G4),
+		        low.beta1 + frac * (high.beta1 - low.beta1),
+		        low.beta2 + frac * (high.beta2 - low.beta2),
+		        low.beta3 + frac * (high.beta3 - low.beta3)};
+	}
+
+private:
+	explicit FilterCoefficientTable(double p_samplerate);
+
+	// p_pitch is clamped to the table range, which clamps the cutoff to 20Hz - 20kHz
+	inline void getPosition(float p_pitch, int &po_index, float &po_frac) const {
+		float position = p_pitch * FILTER_TABLE_STEPS_PER_SEMITONE;
+		position       = position < 0.f ? 0.f : position;
+		position = position > FILTER_TABLE_PITCH_RANGE * FILTER_TABLE_STEPS_PER_SEMITONE ?
+		               FILTER_TABLE_PITCH_RANGE * FILTER_TABLE_STEPS_PER_SEMITONE :
+		               position;
+		po_index = (int)position;
+		po_frac  = position - (float)po_index;
+	}
+
+	FilterCoefficients m_coefficients[FILTER_TABLE_SIZE];
+	DiodeFilterCoefficients m_diode_coefficients[FILTER_TABLE_SIZE];
+};
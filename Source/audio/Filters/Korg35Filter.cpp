@@ -58,11 +58,9 @@ void Korg35Filter::update() {
 	}
 	m_last_freq_modded = m_freq_modded;
 
-	// BZT
-	double wd = 2 * 3.141592653 * m_freq_modded;
-	double wa = (2.0 * m_samplerate) * juce::dsp::FastMathApproximations::tan(wd * m_one_over_samplerate * 0.5);
-	double g  = wa * m_one_over_samplerate * 0.5;
-	double G = g / (1.0 + g);
+	// BZT, prewarped coeffs come from the table
+	double G              = m_coefficients.G;
+	double one_over_1_p_g = m_coefficients.one_over_1_p_g;
 
 	m_LPF1.m_alpha = G;
 	m_LPF2.m_alpha = G;
@@ -76,11 +74,11 @@ void Korg35Filter::update() {
 	m_alpha = 1.0 / (1.0 - m_k_modded * G + m_k_modded * G * G);
 
 	if (m_is_lowpass) {
-		m_LPF2.m_beta = (m_k_modded - m_k_modded * G) / (1.0 + g);
-		m_HPF1.m_beta = -1.0 / (1.0 + g);
+		m_LPF2.m_beta = (m_k_modded - m_k_modded * G) * one_over_1_p_g;
+		m_HPF1.m_beta = -one_over_1_p_g;
 	} else {
-		m_HPF2.m_beta = -1.0 * G / (1.0 + g);
-		m_LPF1.m_beta = 1.0 / (1.0 + g);
+		m_HPF2.m_beta = -1.0 * G * one_over_1_p_g;
+		m_LPF1.m_beta = one_over_1_p_g;
 	}
 }
 
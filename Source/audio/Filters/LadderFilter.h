@@ -70,18 +70,11 @@ public:
     m_k_modded = m_k_modded > 3.88 ? 3.88 : m_k_modded;
     m_k_modded = m_k_modded < 0 ? 0 : m_k_modded;
 
-    // prewarp for BZT
-    double wd = 2 * M_PI * m_freq_modded;
-    //double T = 1 / m_samplerate;
-
-    //note: measured input to tan function, it seemed limited to (0.005699, 1.282283). 
-    //input for fasttan shall be limited to (-pi/2, pi/2) according to documentation
-    double wa = (2 * m_samplerate) * juce::dsp::FastMathApproximations::tan(wd * m_one_over_samplerate * 0.5);
-    double g = wa * m_one_over_samplerate * 0.5;
-
+    // prewarped coeffs for BZT come from the table
     // G - the feedforward coeff in the VA One Pole
     //     same for LPF, HPF
-    double G = g / (1.0 + g);
+    double G              = m_coefficients.G;
+    double one_over_1_p_g = m_coefficients.one_over_1_p_g;
 
     // set alphas
     m_LPF1.m_alpha = G;
@@ -90,10 +83,10 @@ public:
     m_LPF4.m_alpha = G;
 
     // set betas
-    m_LPF1.m_beta = G * G * G / (1.0 + g);
-    m_LPF2.m_beta = G * G / (1.0 + g);
-    m_LPF3.m_beta = G / (1.0 + g);
-    m_LPF4.m_beta = 1.0 / (1.0 + g);
+    m_LPF1.m_beta = G * G * G * one_over_1_p_g;
+    m_LPF2.m_beta = G * G * one_over_1_p_g;
+    m_LPF3.m_beta = G * one_over_1_p_g;
+    m_LPF4.m_beta = one_over_1_p_g;
 
     m_gamma = G * G * G * G; // G^4
 
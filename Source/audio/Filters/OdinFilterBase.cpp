@@ -17,6 +17,8 @@
 
 // --- construction
 OdinFilterBase::OdinFilterBase() {
+	// filters always get the real sample rate before processing, this only avoids a null table
+	m_coefficient_table = &FilterCoefficientTable::getTable(44100.);
 }
 
 OdinFilterBase::~OdinFilterBase() {
@@ -56,4 +58,5 @@ void OdinFilterBase::setResControl(double p_res) {
 void OdinFilterBase::setSampleRate(double d) {
 	m_samplerate          = d;
 	m_one_over_samplerate = 1.f / d;
+	m_coefficient_table   = &FilterCoefficientTable::getTable(d);
 }
\ No newline at end of file
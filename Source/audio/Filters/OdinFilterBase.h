@@ -17,6 +17,7 @@
 
 #include "../../GlobalIncludes.h"
 #include "../JuceLibraryCode/JuceHeader.h"
+#include "FilterCoefficientTable.h"
 #include <cmath>
 
 #define FILTER_FC_MIN 20        // 80Hz
@@ -49,18 +50,23 @@ public:
 		float kbd_modded = m_kbd_mod_amount + *m_kbd_mod_mod < 0 ? 0 : m_kbd_mod_amount + *m_kbd_mod_mod;
 		float vel_modded = m_vel_mod_amount + *m_vel_mod_mod < 0 ? 0 : m_vel_mod_amount + *m_vel_mod_mod;
 
-		m_freq_modded = m_freq_base;
+		// the cutoff only has to be converted when it moves
+		if (m_freq_base != m_last_freq_base) {
+			m_last_freq_base = m_freq_base;
+			m_pitch_base     = FilterCoefficientTable::frequencyToPitch(m_freq_base);
+		}
+
+		// modulation is in semitones, so stay in the pitch domain and let the table clamp to FILTER_FC_MIN/MAX
+		m_pitch_modded = m_pitch_base;
 		if (*m_freq_mod + kbd_modded + m_env_mod_amount + *m_env_mod_mod + vel_modded) {
-			m_freq_modded *= pitchShiftMultiplier(
+			m_pitch_modded +=
 			    *m_freq_mod * FILTER_FREQ_MOD_RANGE_SEMITONES + kbd_modded * m_MIDI_note +
 			    (m_env_value * (m_env_mod_amount + *m_env_mod_mod) + vel_modded * (float)m_MIDI_velocity / 127.f) *
-			        FILTER_ENV_MOD_SEMITONES_MAX);
+			        FILTER_ENV_MOD_SEMITONES_MAX;
 		}
 
-		if (m_freq_modded > FILTER_FC_MAX)
-			m_freq_modded = FILTER_FC_MAX;
-		if (m_freq_modded < FILTER_FC_MIN)
-			m_freq_modded = FILTER_FC_MIN;
+		m_coefficients = m_coefficient_table->getCoefficients(m_pitch_modded);
+		m_freq_modded  = m_coefficients.frequency;
 	}
 
 	inline void applyOverdrive(double &pio_input, float p_tanh_factor = 3.5f) {
@@ -88,7 +94,7 @@ public:
 	double m_freq_base = FILTER_FC_DEFAULT;
 	double m_res_base  = 1;
 
-	int m_MIDI_note     = 0;
+	float m_MIDI_note   = 0; // tuned, so it can be fractional
 	int m_MIDI_velocity = 0;
 
 	float m_kbd_mod_amount = 0;
@@ -112,4 +118,11 @@ protected:
 	double m_one_over_samplerate;
 	double m_freq_modded = FILTER_FC_DEFAULT;
 	double m_res_modded  = FILTER_Q_DEFAULT;
+
+	// cutoff as semitones above FILTER_FC_MIN and the coefficients for it, set in update()
+	const FilterCoefficientTable *m_coefficient_table = nullptr;
+	double m_last_freq_base                           = -1;
+	float m_pitch_base                                = 0.f;
+	float m_pitch_modded                              = 0.f;
+	FilterCoefficients m_coefficients                 = {FILTER_FC_DEFAULT, 0.f, 0.f, 1.f};
 };
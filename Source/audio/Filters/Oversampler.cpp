@@ -0,0 +1,227 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#include "Oversampler.h"
+#include <array>
+#include <cmath>
+
+// nonzero taps next to the center tap per stage and quality
+static const int halfband_branch_taps[2][OVERSAMPLING_MAX_STAGES] = {{16, 8, 4}, {32, 12, 8}};
+// kaiser window beta per quality: roughly 60 dB and 80 dB stopband attenuation
+static const double halfband_kaiser_beta[2] = {6., 8.};
+
+// zeroth order modified bessel function of the first kind for the kaiser window
+static double besselI0(double p_x) {
+	double sum  = 1.;
+	double term = 1.;
+	for (int k = 1; k < 32; ++k) {
+		term *= (p_x / (2. * k)) * (p_x / (2. * k));
+		sum += term;
+	}
+	return sum;
+}
+
+struct HalfbandDesign {
+	float taps[HALFBAND_MAX_BRANCH_TAPS];
+	int num_taps;
+};
+
+// windowed sinc halfband with 2 * p_branch_taps - 1 taps. The center tap is 0.5 and every other tap next to it
+// is zero, only the remaining p_branch_taps taps are stored. They are normalized to a sum of 0.5 for unity gain at DC
+static HalfbandDesign designHalfband(int p_branch_taps, double p_beta) {
+	HalfbandDesign design;
+	design.num_taps = p_branch_taps;
+
+	const double pi     = MathConstants<double>::pi;
+	const double center = (double)(p_branch_taps - 1);
+	double sum          = 0.;
+	for (int tap = 0; tap < p_branch_taps; ++tap) {
+		// tap of the full filter at an even position, its distance to the (odd) center is odd
+		const double n        = 2. * tap;
+		const double distance = n - center;
+		const double ratio    = distance / (center + 1.);
+		const double window   = besselI0(p_beta * sqrt(jmax(0., 1. - ratio * ratio))) / besselI0(p_beta);
+		const double sinc     = sin(0.5 * pi * distance) / (pi * distance);
+		design.taps[tap]      = (float)(sinc * window);
+		sum += sinc * window;
+	}
+	for (int tap = 0; tap < p_branch_taps; ++tap) {
+		design.taps[tap] = (float)(design.taps[tap] * 0.5 / sum);
+	}
+	return design;
+}
+
+static const HalfbandDesign &getHalfbandDesign(int p_stage, int p_quality) {
+	// designed once on first use, the voices share the taps
+	static const auto designs = []() {
+		std::array<std::array<HalfbandDesign, OVERSAMPLING_MAX_STAGES>, 2> result;
+		for (int quality = 0; quality < 2; ++quality) {
+			for (int stage = 0; stage < OVERSAMPLING_MAX_STAGES; ++stage) {
+				result[quality][stage] =
+				    designHalfband(halfband_branch_taps[quality][stage], halfband_kaiser_beta[quality]);
+			}
+		}
+		return result;
+	}();
+	return designs[p_quality][p_stage];
+}
+
+void HalfbandFilter::setTaps(const float *p_taps, int p_num_taps) {
+	jassert(p_num_taps % 2 == 0 && p_num_taps <= HALFBAND_MAX_BRANCH_TAPS);
+	m_taps     = p_taps;
+	m_num_taps = p_num_taps;
+	reset();
+}
+
+void HalfbandFilter::reset() {
+	for (int index = 0; index < HALFBAND_MAX_BRANCH_TAPS; ++index) {
+		m_branch_history[index] = 0.f;
+		m_center_history[index] = 0.f;
+	}
+}
+
+void HalfbandFilter::doBranch(const float *p_input, float *p_output, int p_num_samples) const {
+	for (int sample = 0; sample < p_num_samples; ++sample) {
+		p_output[sample] = 0.f;
+	}
+	// newest input is multiplied with the first tap
+	const float *newest = p_input + m_num_taps - 1;
+	for (int tap = 0; tap < m_num_taps; ++tap) {
+		const float coefficient = m_taps[tap];
+		const float *input      = newest - tap;
+		for (int sample = 0; sample < p_num_samples; ++sample) {
+			p_output[sample] += coefficient * input[sample];
+		}
+	}
+}
+
+void HalfbandFilter::interpolate(const float *p_input, float *p_output, int p_num_samples) {
+	jassert(p_num_samples <= HALFBAND_MAX_BLOCK);
+
+	const int history = m_num_taps - 1;
+	float input[HALFBAND_MAX_BRANCH_TAPS + HALFBAND_MAX_BLOCK];
+	for (int index = 0; index < history; ++index) {
+		input[index] = m_branch_history[index];
+	}
+	for (int sample = 0; sample < p_num_samples; ++sample) {
+		input[history + sample] = p_input[sample];
+	}
+
+	float branch[HALFBAND_MAX_BLOCK];
+	doBranch(input, branch, p_num_samples);
+
+	// the delay branch only has the center tap, which is 0.5 and doubled for the zero stuffing
+	const float *delayed = input + history - (m_num_taps / 2 - 1);
+	for (int sample = 0; sample < p_num_samples; ++sample) {
+		p_output[2 * sample]     = 2.f * branch[sample];
+		p_output[2 * sample + 1] = delayed[sample];
+	}
+
+	for (int index = 0; index < history; ++index) {
+		m_branch_history[index] = input[p_num_samples + index];
+	}
+}
+
+void HalfbandFilter::decimate(const float *p_input, float *p_output, int p_num_samples) {
+	jassert(p_num_samples <= HALFBAND_MAX_BLOCK);
+
+	// split into the even samples for the FIR branch and the odd ones for the center tap
+	const int history        = m_num_taps - 1;
+	const int center_history = m_num_taps / 2;
+	float even[HALFBAND_MAX_BRANCH_TAPS + HALFBAND_MAX_BLOCK];
+	float odd[HALFBAND_MAX_BRANCH_TAPS + HALFBAND_MAX_BLOCK];
+	for (int index = 0; index < history; ++index) {
+		even[index] = m_branch_history[index];
+	}
+	for (int index = 0; index < center_history; ++index) {
+		odd[index] = m_center_history[index];
+	}
+	for (int sample = 0; sample < p_num_samples; ++sample) {
+		even[history + sample]       = p_input[2 * sample];
+		odd[center_history + sample] = p_input[2 * sample + 1];
+	}
+
+	doBranch(even, p_output, p_num_samples);
+	for (int sample = 0; sample < p_num_samples; ++sample) {
+		p_output[sample] += 0.5f * odd[sample];
+	}
+
+	for (int index = 0; index < history; ++index) {
+		m_branch_history[index] = even[p_num_samples + index];
+	}
+	for (int index = 0; index < center_history; ++index) {
+		m_center_history[index] = odd[p_num_samples + index];
+	}
+}
+
+Oversampler::Oversampler() {
+	setup(4, Low);
+}
+
+void Oversampler::setup(int p_factor, Quality p_quality) {
+	jassert(p_factor == 2 || p_factor == 4 || p_factor == 8);
+	m_stages = p_factor >= 8 ? 3 : (p_factor >= 4 ? 2 : 1);
+	for (int stage = 0; stage < m_stages; ++stage) {
+		const HalfbandDesign &design = getHalfbandDesign(stage, p_quality);
+		m_up[stage].setTaps(design.taps, design.num_taps);
+		m_down[stage].setTaps(design.taps, design.num_taps);
+	}
+}
+
+void Oversampler::reset() {
+	for (int stage = 0; stage < m_stages; ++stage) {
+		m_up[stage].reset();
+		m_down[stage].reset();
+	}
+}
+
+float Oversampler::getLatency() const {
+	// each stage delays by its latency at its higher rate, once up and once down
+	float latency = 0.f;
+	for (int stage = 0; stage < m_stages; ++stage) {
+		latency += 2.f * (float)m_up[stage].getLatency() / (float)(2 << stage);
+	}
+	return latency;
+}
+
+void Oversampler::upsample(const float *p_input, float *p_output, int p_num_samples) {
+	jassert(p_num_samples <= OVERSAMPLING_MAX_BLOCK);
+
+	// the intermediate stages ping pong between the scratch buffer and the output
+	float scratch[OVERSAMPLING_MAX_BLOCK * OVERSAMPLING_MAX_FACTOR / 2];
+	const float *input = p_input;
+	int num_samples    = p_num_samples;
+	for (int stage = 0; stage < m_stages; ++stage) {
+		// the last stage writes to the output, so the one before it has to write to the scratch buffer
+		float *output = ((m_stages - 1 - stage) % 2 == 0) ? p_output : scratch;
+		m_up[stage].interpolate(input, output, num_samples);
+		input = output;
+		num_samples *= 2;
+	}
+}
+
+void Oversampler::downsample(const float *p_input, float *p_output, int p_num_samples) {
+	jassert(p_num_samples <= OVERSAMPLING_MAX_BLOCK);
+
+	float scratch[2][OVERSAMPLING_MAX_BLOCK * OVERSAMPLING_MAX_FACTOR / 2];
+	const float *input = p_input;
+	int num_samples    = p_num_samples << (m_stages - 1);
+	for (int stage = m_stages - 1; stage >= 0; --stage) {
+		float *output = stage == 0 ? p_output : scratch[stage % 2];
+		m_down[stage].decimate(input, output, num_samples);
+		input = output;
+		num_samples /= 2;
+	}
+}
@@ -0,0 +1,85 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#pragma once
+
+#include "../../GlobalIncludes.h"
+
+#define OVERSAMPLING_MAX_STAGES 3 // 8x
+#define OVERSAMPLING_MAX_FACTOR (1 << OVERSAMPLING_MAX_STAGES)
+#define OVERSAMPLING_MAX_BLOCK SUB_BLOCK_SIZE // max samples per call at the base rate
+#define HALFBAND_MAX_BRANCH_TAPS 32
+#define HALFBAND_MAX_BLOCK (OVERSAMPLING_MAX_BLOCK * OVERSAMPLING_MAX_FACTOR / 2) // max samples per call at the lower rate
+
+// One 2x stage of the oversampler: a linear phase halfband FIR in polyphase form. Every second tap of a halfband
+// filter is zero, so one branch is a short FIR and the other one a pure delay. An instance is either used to
+// interpolate or to decimate, not both.
+class HalfbandFilter {
+public:
+	// p_taps are the nonzero taps next to the center tap, see Oversampler.cpp. They have to outlive the filter
+	void setTaps(const float *p_taps, int p_num_taps);
+	void reset();
+
+	// p_output gets 2 * p_num_samples samples
+	void interpolate(const float *p_input, float *p_output, int p_num_samples);
+	// p_input has 2 * p_num_samples samples
+	void decimate(const float *p_input, float *p_output, int p_num_samples);
+
+	// group delay at the higher rate
+	int getLatency() const {
+		return m_num_taps - 1;
+	}
+
+private:
+	// FIR over p_input, which is preceded by m_num_taps - 1 samples of history. Loops over the taps outside and
+	// over the samples inside, so the inner loop vectorizes and every output still sums up in the same order
+	void doBranch(const float *p_input, float *p_output, int p_num_samples) const;
+
+	const float *m_taps = nullptr;
+	int m_num_taps      = 0;
+	// the last inputs of the FIR branch and the delay branch of the previous call
+	float m_branch_history[HALFBAND_MAX_BRANCH_TAPS] = {0.f};
+	float m_center_history[HALFBAND_MAX_BRANCH_TAPS] = {0.f};
+};
+
+// Block based 2x, 4x or 8x oversampling made of cascaded halfband stages. The first stage has the narrowest
+// transition band and most of the taps, the later stages only have to remove images far above the audio band.
+class Oversampler {
+public:
+	enum Quality { Low = 0, High = 1 };
+
+	Oversampler();
+
+	// p_factor is 2, 4 or 8. Clears the state
+	void setup(int p_factor, Quality p_quality);
+	void reset();
+
+	int getFactor() const {
+		return 1 << m_stages;
+	}
+
+	// delay of upsample() followed by downsample() in samples at the base rate, depends on factor and quality
+	float getLatency() const;
+
+	// p_output gets p_num_samples * getFactor() samples
+	void upsample(const float *p_input, float *p_output, int p_num_samples);
+	// p_input has p_num_samples * getFactor() samples
+	void downsample(const float *p_input, float *p_output, int p_num_samples);
+
+private:
+	int m_stages = 2;
+	HalfbandFilter m_up[OVERSAMPLING_MAX_STAGES];
+	HalfbandFilter m_down[OVERSAMPLING_MAX_STAGES];
+};
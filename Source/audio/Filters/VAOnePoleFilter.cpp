@@ -46,12 +46,7 @@ void VAOnePoleFilter::update() {
 	// base class does modulation, changes m_fFc
 	OdinFilterBase::update();
 
-	double wd = 2 * M_PI * m_freq_modded;
-	double T  = 1 / m_samplerate;
-	double wa = (2 / T) * tan(wd * T / 2);
-	double g  = wa * T / 2;
-
-	m_alpha = g / (1.0 + g);
+	m_alpha = m_coefficients.G;
 }
 
 // do the filter
@@ -0,0 +1,52 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#pragma once
+
+#include "include/Tunings.h"
+#include <algorithm>
+
+#define NOTE_FREQUENCY_TABLE_SIZE 128
+
+// Frequency of every MIDI note in the current tuning and the fractional note number it really sounds at, which is
+// what key tracking follows. Rebuilt on the message thread when the tuning changes, the voices look notes up on
+// voice start, so microtonal tunings cost the same as 12-TET.
+class NoteFrequencyTable {
+public:
+	void build(const Tunings::Tuning &p_tuning) {
+		for (int note = 0; note < NOTE_FREQUENCY_TABLE_SIZE; ++note) {
+			m_frequency[note]  = (float)p_tuning.frequencyForMidiNote(note);
+			// log2 of the frequency relative to MIDI note 0, so 12 per octave
+			m_tuned_note[note] = (float)(12. * p_tuning.logScaledFrequencyForMidiNote(note));
+		}
+	}
+
+	float getFrequency(int p_note) const {
+		return m_frequency[clampNote(p_note)];
+	}
+
+	// equals p_note in 12-TET
+	float getTunedNote(int p_note) const {
+		return m_tuned_note[clampNote(p_note)];
+	}
+
+private:
+	static int clampNote(int p_note) {
+		return std::min(std::max(p_note, 0), NOTE_FREQUENCY_TABLE_SIZE - 1);
+	}
+
+	float m_frequency[NOTE_FREQUENCY_TABLE_SIZE]  = {0.f};
+	float m_tuned_note[NOTE_FREQUENCY_TABLE_SIZE] = {0.f};
+};
@@ -27,6 +27,9 @@
 //#define SPECDRAW_LENGTH 100
 #define NUMBER_OF_HARMONICS 256 //maximum harmonics used (Wavetable length is 512 -> nyquist -> 256)
 #define WAVETABLE_LENGTH 512 //how long the actual wavetable is
+#define WAVETABLE_FFT_ORDER 9 //log2(WAVETABLE_LENGTH), fft size used to build tables
+#define WAVETABLE_CONST_DATA_SAMPLERATE 44100.f //the compiled in wavetables are band limited for this rate
+#define WAVETABLE_CACHE_VERSION 1 //increase when the table generation changes
 #define MAX_EXPECTED_SAMPLE_RATE 192000 //use this for calculation of Delaylength
 #define MAX_DELAY_TIME 4//max delay time at max samplerate in seconds
 
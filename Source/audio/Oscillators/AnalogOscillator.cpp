@@ -29,10 +29,10 @@ AnalogOscillator::~AnalogOscillator() {
 
 void AnalogOscillator::loadWavetables() {
 	// load the saw table for square as well since PWM is generated from saw
-	setWavetablePointer(0, m_WT_container->getWavetablePointers("FatSaw"));
-	setWavetablePointer(1, m_WT_container->getWavetablePointers("FatSaw"));
-	setWavetablePointer(2, m_WT_container->getWavetablePointers("Triangle"));
-	setWavetablePointer(3, m_WT_container->getWavetablePointers("Sine"));
+	setWavetablePointer(0, m_WT_container->getWavetablePointers(WavetableID::FatSaw));
+	setWavetablePointer(1, m_WT_container->getWavetablePointers(WavetableID::FatSaw));
+	setWavetablePointer(2, m_WT_container->getWavetablePointers(WavetableID::Triangle));
+	setWavetablePointer(3, m_WT_container->getWavetablePointers(WavetableID::Sine));
 
 	// init drift generator
 	m_drift_generator.initialize(m_samplerate);
@@ -47,6 +47,11 @@ public:
 		m_duty_smooth = m_duty;
 	}
 
+	// the square wave is not a table read
+	bool isPlainWavetable() const {
+		return m_wavetable_index != 1 && WavetableOsc1D::isPlainWavetable();
+	}
+
 	void setSampleRate(float p_sr) override {
 		WavetableOsc1D::setSampleRate(p_sr);
 		m_drift_generator.setSampleRate(p_sr);
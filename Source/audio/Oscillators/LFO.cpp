@@ -16,26 +16,26 @@
 #include "LFO.h"
 
 void LFO::loadWavetables() {
-	setWavetablePointer(0, m_WT_container->getWavetablePointers("Sine"));
-	setWavetablePointer(1, m_WT_container->getWavetablePointers("Saw"));
-	setWavetablePointer(2, m_WT_container->getWavetablePointers("Triangle"));
+	setWavetablePointer(0, m_WT_container->getWavetablePointers(WavetableID::Sine));
+	setWavetablePointer(1, m_WT_container->getWavetablePointers(WavetableID::Saw));
+	setWavetablePointer(2, m_WT_container->getWavetablePointers(WavetableID::Triangle));
 
-	setWavetablePointer(3, m_WT_container->getLFOPointers("Square50"));
-	setWavetablePointer(4, m_WT_container->getLFOPointers("Square25"));
-	setWavetablePointer(5, m_WT_container->getLFOPointers("Square12"));
+	setWavetablePointer(3, m_WT_container->getLFOPointers(LFOTableID::Square50));
+	setWavetablePointer(4, m_WT_container->getLFOPointers(LFOTableID::Square25));
+	setWavetablePointer(5, m_WT_container->getLFOPointers(LFOTableID::Square12));
 
-	setWavetablePointer(6, m_WT_container->getLFOPointers("Spike"));
+	setWavetablePointer(6, m_WT_container->getLFOPointers(LFOTableID::Spike));
 
-	setWavetablePointer(7, m_WT_container->getLFOPointers("Pyramid4"));
-	setWavetablePointer(8, m_WT_container->getLFOPointers("Pyramid6"));
-	setWavetablePointer(9, m_WT_container->getLFOPointers("Pyramid8"));
-	setWavetablePointer(10, m_WT_container->getLFOPointers("Pyramid12"));
+	setWavetablePointer(7, m_WT_container->getLFOPointers(LFOTableID::Pyramid4));
+	setWavetablePointer(8, m_WT_container->getLFOPointers(LFOTableID::Pyramid6));
+	setWavetablePointer(9, m_WT_container->getLFOPointers(LFOTableID::Pyramid8));
+	setWavetablePointer(10, m_WT_container->getLFOPointers(LFOTableID::Pyramid12));
 
-	setWavetablePointer(11, m_WT_container->getLFOPointers("Stair3"));
-	setWavetablePointer(12, m_WT_container->getLFOPointers("Stair4"));
-	setWavetablePointer(13, m_WT_container->getLFOPointers("Stair6"));
-	setWavetablePointer(14, m_WT_container->getLFOPointers("Stair8"));
-	setWavetablePointer(15, m_WT_container->getLFOPointers("Stair12"));
+	setWavetablePointer(11, m_WT_container->getLFOPointers(LFOTableID::Stair3));
+	setWavetablePointer(12, m_WT_container->getLFOPointers(LFOTableID::Stair4));
+	setWavetablePointer(13, m_WT_container->getLFOPointers(LFOTableID::Stair6));
+	setWavetablePointer(14, m_WT_container->getLFOPointers(LFOTableID::Stair8));
+	setWavetablePointer(15, m_WT_container->getLFOPointers(LFOTableID::Stair12));
 
 	setWavetablePointerNONCONST(16, m_WT_container->getWavedrawPointer(0));
 	setWavetablePointerNONCONST(17, m_WT_container->getWavedrawPointer(1));
@@ -23,37 +23,32 @@
 
 #include "../JuceLibraryCode/JuceHeader.h"
 
-WavetableContainer::WavetableContainer() {
-//#ifdef ODIN_DEBUG
-#include "WavetableCoefficients.h"
-//#endif
-
-	// dynamically allocate wavetables
-	// m_wavetables = new
-	// float[NUMBER_OF_WAVETABLES][SUBTABLES_PER_WAVETABLE][WAVETABLE_LENGTH];
-	m_wavetables = new float **[NUMBER_OF_WAVETABLES];
-	for (int table = 0; table < NUMBER_OF_WAVETABLES; ++table) {
-		m_wavetables[table] = new float *[SUBTABLES_PER_WAVETABLE];
-		for (int sub = 0; sub < SUBTABLES_PER_WAVETABLE; ++sub) {
-			m_wavetables[table][sub] = new float[WAVETABLE_LENGTH];
-		}
-	}
+#define DRAW_BUFFER_INDEX 3 // mask for the buffer index in m_draw_buffer_middle
+#define DRAW_BUFFER_NEW 4   // flag in m_draw_buffer_middle: buffer holds a table the audio thread hasn't seen
 
+WavetableContainer::WavetableContainer() {
 	// create specdraw scalar
 	for (int harmonic = 1; harmonic < SPECDRAW_STEPS_X + 1; ++harmonic) {
 		m_specdraw_scalar[harmonic - 1] = 1.f / sqrtf((float)harmonic);
 	}
+
+	// until the first table of a slot was built in the background the oscs read these
+	for (int table = 0; table < NUMBER_OF_WAVEDRAW_TABLES; ++table) {
+		pointToDrawTable(Wavedraw, table, m_wavedraw_tables[table]);
+		pointToDrawTable(Chipdraw, table, m_chipdraw_tables[table]);
+		pointToDrawTable(Specdraw, table, m_specdraw_tables[table]);
+	}
+
+	for (int slot = 0; slot < NUMBER_OF_DRAW_TABLE_SLOTS; ++slot) {
+		m_draw_buffer_back[slot]   = 0;
+		m_draw_buffer_middle[slot] = 1;
+		m_draw_buffer_front[slot]  = 2;
+	}
+	m_draw_table_worker.startThread();
 }
 
 WavetableContainer::~WavetableContainer() {
-	// delete wavetables
-	for (int table = 0; table < NUMBER_OF_WAVETABLES; ++table) {
-		for (int sub = 0; sub < SUBTABLES_PER_WAVETABLE; ++sub) {
-			delete[] m_wavetables[table][sub];
-		}
-		delete[] m_wavetables[table];
-	}
-	delete[] m_wavetables;
+	m_draw_table_worker.stopThread(1000);
 }
 /*
 void WavetableContainer::createWavetables(float p_samplerate) {
@@ -185,88 +180,192 @@ void WavetableContainer::createLFOtables(float p_samplerate) {
 void WavetableContainer::createChipdrawTable(int p_table_nr,
                                              float p_chipdraw_values[CHIPDRAW_STEPS_X],
                                              float p_samplerate) {
+	buildDrawTable(m_fft, Chipdraw, p_chipdraw_values, p_samplerate, false, m_chipdraw_tables[p_table_nr]);
+	pointToDrawTable(Chipdraw, p_table_nr, m_chipdraw_tables[p_table_nr]);
+}
 
-	// first generate the fourier coefficients
-	float chipdraw_coefficients[SIN_AND_COS][NUMBER_OF_HARMONICS];
+void WavetableContainer::createWavedrawTable(int p_table_nr,
+                                             float p_wavedraw_values[WAVEDRAW_STEPS_X],
+                                             float p_samplerate,
+                                             bool p_const_sections) {
+	buildDrawTable(m_fft, Wavedraw, p_wavedraw_values, p_samplerate, p_const_sections, m_wavedraw_tables[p_table_nr]);
+	pointToDrawTable(Wavedraw, p_table_nr, m_wavedraw_tables[p_table_nr]);
+}
 
-	float step_width = 2 * PI / CHIPDRAW_STEPS_X;
+void WavetableContainer::createSpecdrawTable(int p_table_nr,
+                                             float p_specdraw_values[SPECDRAW_STEPS_X],
+                                             float p_samplerate) {
+	buildDrawTable(m_fft, Specdraw, p_specdraw_values, p_samplerate, false, m_specdraw_tables[p_table_nr]);
+	pointToDrawTable(Specdraw, p_table_nr, m_specdraw_tables[p_table_nr]);
+}
 
-	for (int harmonic = 1; harmonic < NUMBER_OF_HARMONICS; ++harmonic) {
+void WavetableContainer::requestChipdrawTable(int p_table_nr,
+                                              float p_chipdraw_values[CHIPDRAW_STEPS_X],
+                                              float p_samplerate) {
+	requestDrawTable(Chipdraw, p_table_nr, p_chipdraw_values, CHIPDRAW_STEPS_X, p_samplerate, false);
+}
 
-		float coeff_sine   = 0.f;
-		float coeff_cosine = 0.f;
+void WavetableContainer::requestWavedrawTable(int p_table_nr,
+                                              float p_wavedraw_values[WAVEDRAW_STEPS_X],
+                                              float p_samplerate,
+                                              bool p_const_sections) {
+	requestDrawTable(Wavedraw, p_table_nr, p_wavedraw_values, WAVEDRAW_STEPS_X, p_samplerate, p_const_sections);
+}
 
-		for (int segment = 0; segment < CHIPDRAW_STEPS_X; ++segment) {
-			coeff_sine += const_segment_one_overtone_sine(
-			    segment * step_width, (segment + 1) * step_width, p_chipdraw_values[segment], harmonic);
-			coeff_cosine += const_segment_one_overtone_cosine(
-			    segment * step_width, (segment + 1) * step_width, p_chipdraw_values[segment], harmonic);
-		}
-		chipdraw_coefficients[0][harmonic] = coeff_sine;
-		chipdraw_coefficients[1][harmonic] = coeff_cosine;
-	}
+void WavetableContainer::requestSpecdrawTable(int p_table_nr,
+                                              float p_specdraw_values[SPECDRAW_STEPS_X],
+                                              float p_samplerate) {
+	requestDrawTable(Specdraw, p_table_nr, p_specdraw_values, SPECDRAW_STEPS_X, p_samplerate, false);
+}
 
-	// now create the wavetable from the fourier coefficients
-	double seed_freq = 27.5; // A0
-	float max        = 0.f;
+void WavetableContainer::requestDrawTable(int p_type,
+                                          int p_table_nr,
+                                          const float *p_values,
+                                          int p_number_of_values,
+                                          float p_samplerate,
+                                          bool p_const_sections) {
+	{
+		// a request which wasn't picked up yet is simply replaced
+		const ScopedLock lock(m_draw_request_lock);
+		DrawTableRequest &request = m_draw_requests[drawTableSlot(p_type, p_table_nr)];
+		memcpy(request.values, p_values, p_number_of_values * sizeof(float));
+		request.samplerate     = p_samplerate;
+		request.const_sections = p_const_sections;
+		request.pending        = true;
+	}
+	m_draw_table_worker.notify();
+}
 
-	// delete old table
-	memset(m_chipdraw_tables[p_table_nr], 0, SUBTABLES_PER_WAVETABLE * WAVETABLE_LENGTH * sizeof(float));
+void WavetableContainer::DrawTableWorker::run() {
+	while (!threadShouldExit()) {
+		wait(-1);
+		m_container.buildRequestedDrawTables(m_fft);
+	}
+}
 
-	// loop over subtables
-	for (int index_sub_table = 0; index_sub_table < SUBTABLES_PER_WAVETABLE; ++index_sub_table) {
+void WavetableContainer::finishDrawTables() {
+	buildRequestedDrawTables(m_fft);
+}
 
-		// how many harmonics are needed for this subtable
-		int number_of_harmonics = (int)((p_samplerate * 0.5f / seed_freq) - 1);
+void WavetableContainer::buildRequestedDrawTables(dsp::FFT &p_fft) {
+	const ScopedLock build_lock(m_draw_build_lock);
+	for (int slot = 0; slot < NUMBER_OF_DRAW_TABLE_SLOTS; ++slot) {
+		DrawTableRequest request;
+		{
+			const ScopedLock lock(m_draw_request_lock);
+			if (!m_draw_requests[slot].pending) {
+				continue;
+			}
+			request                       = m_draw_requests[slot];
+			m_draw_requests[slot].pending = false;
+		}
 
-		// don't allow more than 256 harmonics (for big Samplerates this might
-		// happen)
-		number_of_harmonics = number_of_harmonics > NUMBER_OF_HARMONICS ? NUMBER_OF_HARMONICS : number_of_harmonics;
+		if (!m_draw_buffers[slot]) {
+			// published to the audio thread together with the first table
+			m_draw_buffers[slot].reset(new DrawTable[3]);
+		}
 
-		for (int index_position = 0; index_position < WAVETABLE_LENGTH; ++index_position) {
-			for (int index_harmonics = 1; index_harmonics < number_of_harmonics; ++index_harmonics) {
+		buildDrawTable(p_fft,
+		               slot / NUMBER_OF_WAVEDRAW_TABLES,
+		               request.values,
+		               request.samplerate,
+		               request.const_sections,
+		               m_draw_buffers[slot][m_draw_buffer_back[slot]]);
+
+		// publish the table, the old middle buffer is the next back buffer
+		m_draw_buffer_back[slot] =
+		    m_draw_buffer_middle[slot].exchange(m_draw_buffer_back[slot] | DRAW_BUFFER_NEW, std::memory_order_acq_rel) &
+		    DRAW_BUFFER_INDEX;
+	}
+}
 
-				// fill table with
-				// sine harmonics
-				m_chipdraw_tables[p_table_nr][index_sub_table][index_position] +=
-				    chipdraw_coefficients[0][index_harmonics] *
-				    sin(2.f * PI * index_position * index_harmonics / (float)WAVETABLE_LENGTH);
-				// cosine
-				m_chipdraw_tables[p_table_nr][index_sub_table][index_position] +=
-				    chipdraw_coefficients[1][index_harmonics] *
-				    cos(2.f * PI * index_position * index_harmonics / (float)WAVETABLE_LENGTH);
-			}
-			// find max among all tables
-			if (fabs(m_chipdraw_tables[p_table_nr][index_sub_table][index_position]) > max) {
-				max = fabs(m_chipdraw_tables[p_table_nr][index_sub_table][index_position]);
-			}
+bool WavetableContainer::installDrawTables() {
+	bool installed = false;
+	for (int slot = 0; slot < NUMBER_OF_DRAW_TABLE_SLOTS; ++slot) {
+		if (!(m_draw_buffer_middle[slot].load(std::memory_order_relaxed) & DRAW_BUFFER_NEW)) {
+			continue;
 		}
-		// increment seed frequency by minor third = 2^(3/12)
-		seed_freq *= 1.1892071150;
+		m_draw_buffer_front[slot] =
+		    m_draw_buffer_middle[slot].exchange(m_draw_buffer_front[slot], std::memory_order_acq_rel) &
+		    DRAW_BUFFER_INDEX;
+
+		// no osc is reading between blocks, and they pick up the subtable pointer again with every sample
+		pointToDrawTable(slot / NUMBER_OF_WAVEDRAW_TABLES,
+		                 slot % NUMBER_OF_WAVEDRAW_TABLES,
+		                 m_draw_buffers[slot][m_draw_buffer_front[slot]]);
+		installed = true;
+	}
+	return installed;
+}
 
-		// set pointers
-		m_chipdraw_pointers[p_table_nr][index_sub_table] = m_chipdraw_tables[p_table_nr][index_sub_table];
+float **WavetableContainer::getDrawPointers(int p_type, int p_table_nr) {
+	switch (p_type) {
+	case Chipdraw:
+		return m_chipdraw_pointers[p_table_nr];
+	case Specdraw:
+		return m_specdraw_pointers[p_table_nr];
+	case Wavedraw:
+	default:
+		return m_wavedraw_pointers[p_table_nr];
 	}
+}
 
-	// do another round to scale the table
-	// avoid division by 0
-	if (max > 1e-5) {
-		max = 1.f / max; // for faster computation
+void WavetableContainer::pointToDrawTable(int p_type, int p_table_nr, DrawTable &p_table) {
+	float **pointers = getDrawPointers(p_type, p_table_nr);
+	for (int sub = 0; sub < SUBTABLES_PER_WAVETABLE; ++sub) {
+		pointers[sub] = p_table[sub];
 	}
-	for (int index_sub_table = 0; index_sub_table < SUBTABLES_PER_WAVETABLE; ++index_sub_table) {
-		for (int index_position = 0; index_position < WAVETABLE_LENGTH; ++index_position) {
-			m_chipdraw_tables[p_table_nr][index_sub_table][index_position] *= max;
-		}
+}
+
+void WavetableContainer::buildDrawTable(dsp::FFT &p_fft,
+                                        int p_type,
+                                        const float *p_values,
+                                        float p_samplerate,
+                                        bool p_const_sections,
+                                        DrawTable &p_table) {
+	float coefficients[SIN_AND_COS][NUMBER_OF_HARMONICS] = {{0.f}};
+
+	switch (p_type) {
+	case Chipdraw:
+		chipdrawCoefficients(p_values, coefficients);
+		buildBandLimitedTable(p_fft, coefficients, NUMBER_OF_HARMONICS, p_samplerate, &p_table[0][0]);
+		break;
+	case Specdraw:
+		specdrawCoefficients(p_values, coefficients);
+		buildBandLimitedTable(p_fft, coefficients, SPECDRAW_STEPS_X + 1, p_samplerate, &p_table[0][0]);
+		break;
+	case Wavedraw:
+	default:
+		wavedrawCoefficients(p_values, p_const_sections, coefficients);
+		buildBandLimitedTable(p_fft, coefficients, NUMBER_OF_HARMONICS, p_samplerate, &p_table[0][0]);
+		break;
 	}
 }
 
-void WavetableContainer::createWavedrawTable(int p_table_nr,
-                                             float p_wavedraw_values[WAVEDRAW_STEPS_X],
-                                             float p_samplerate,
-                                             bool p_const_sections) {
+void WavetableContainer::chipdrawCoefficients(const float *p_chipdraw_values,
+                                              float p_coefficients[SIN_AND_COS][NUMBER_OF_HARMONICS]) {
 
-	// first generate the fourier coefficients
-	float wavedraw_coefficients[SIN_AND_COS][NUMBER_OF_HARMONICS];
+	float step_width = 2 * PI / CHIPDRAW_STEPS_X;
+
+	for (int harmonic = 1; harmonic < NUMBER_OF_HARMONICS; ++harmonic) {
+
+		float coeff_sine   = 0.f;
+		float coeff_cosine = 0.f;
+
+		for (int segment = 0; segment < CHIPDRAW_STEPS_X; ++segment) {
+			coeff_sine += const_segment_one_overtone_sine(
+			    segment * step_width, (segment + 1) * step_width, p_chipdraw_values[segment], harmonic);
+			coeff_cosine += const_segment_one_overtone_cosine(
+			    segment * step_width, (segment + 1) * step_width, p_chipdraw_values[segment], harmonic);
+		}
+		p_coefficients[0][harmonic] = coeff_sine;
+		p_coefficients[1][harmonic] = coeff_cosine;
+	}
+}
+
+void WavetableContainer::wavedrawCoefficients(const float *p_wavedraw_values,
+                                              bool p_const_sections,
+                                              float p_coefficients[SIN_AND_COS][NUMBER_OF_HARMONICS]) {
 
 	float step_width = 2 * PI / WAVEDRAW_STEPS_X;
 
@@ -299,16 +398,32 @@ void WavetableContainer::createWavedrawTable(int p_table_nr,
 				                                                harmonic);
 			}
 		}
-		wavedraw_coefficients[0][harmonic] = coeff_sine;
-		wavedraw_coefficients[1][harmonic] = coeff_cosine;
+		p_coefficients[0][harmonic] = coeff_sine;
+		p_coefficients[1][harmonic] = coeff_cosine;
+	}
+}
+
+void WavetableContainer::specdrawCoefficients(const float *p_specdraw_values,
+                                              float p_coefficients[SIN_AND_COS][NUMBER_OF_HARMONICS]) {
+	// sine harmonics only
+	for (int harmonic = 1; harmonic < SPECDRAW_STEPS_X + 1; ++harmonic) {
+		p_coefficients[0][harmonic] = p_specdraw_values[harmonic - 1] * m_specdraw_scalar[harmonic - 1];
 	}
+}
+
+void WavetableContainer::buildBandLimitedTable(dsp::FFT &p_fft,
+                                               float p_coefficients[SIN_AND_COS][NUMBER_OF_HARMONICS],
+                                               int p_max_harmonics,
+                                               float p_samplerate,
+                                               float *p_table) {
+	jassert(p_fft.getSize() == WAVETABLE_LENGTH);
 
-	// now create the wavetable from the fourier coefficients
-	double seed_freq = 27.5; // A0
-	float max        = 0.f;
+	// real-only inverse fft works in place on 2 * WAVETABLE_LENGTH floats
+	float spectrum[2 * WAVETABLE_LENGTH];
 
-	// delete old table
-	memset(m_wavedraw_tables[p_table_nr], 0, SUBTABLES_PER_WAVETABLE * WAVETABLE_LENGTH * sizeof(float));
+	double seed_freq          = 27.5; // A0
+	float max                 = 0.f;
+	int last_number_harmonics = -1;
 
 	// loop over subtables
 	for (int index_sub_table = 0; index_sub_table < SUBTABLES_PER_WAVETABLE; ++index_sub_table) {
@@ -318,83 +433,35 @@ void WavetableContainer::createWavedrawTable(int p_table_nr,
 
 		// don't allow more than 256 harmonics (for big Samplerates this might
 		// happen)
-		number_of_harmonics = number_of_harmonics > NUMBER_OF_HARMONICS ? NUMBER_OF_HARMONICS : number_of_harmonics;
-
-		for (int index_position = 0; index_position < WAVETABLE_LENGTH; ++index_position) {
-			for (int index_harmonics = 1; index_harmonics < number_of_harmonics; ++index_harmonics) {
+		number_of_harmonics = number_of_harmonics > p_max_harmonics ? p_max_harmonics : number_of_harmonics;
 
-				// fill table with
-				// sine harmonics
-				m_wavedraw_tables[p_table_nr][index_sub_table][index_position] +=
-				    wavedraw_coefficients[0][index_harmonics] *
-				    sin(2.f * PI * index_position * index_harmonics / (float)WAVETABLE_LENGTH);
-				// cosine
-				m_wavedraw_tables[p_table_nr][index_sub_table][index_position] +=
-				    wavedraw_coefficients[1][index_harmonics] *
-				    cos(2.f * PI * index_position * index_harmonics / (float)WAVETABLE_LENGTH);
-			}
-			// find max among all tables
-			if (fabs(m_wavedraw_tables[p_table_nr][index_sub_table][index_position]) > max) {
-				max = fabs(m_wavedraw_tables[p_table_nr][index_sub_table][index_position]);
-			}
-		}
 		// increment seed frequency by minor third = 2^(3/12)
 		seed_freq *= 1.1892071150;
 
-		// set pointers
-		m_wavedraw_pointers[p_table_nr][index_sub_table] = m_wavedraw_tables[p_table_nr][index_sub_table];
-		// DBG((long)m_wavedraw_pointers[p_table_nr][index_sub_table]);
-	}
+		float *sub_table = p_table + index_sub_table * WAVETABLE_LENGTH;
 
-	// do another round to scale the table
-	// avoid division by 0
-	if (max > 1e-5) {
-		max = 1.f / max; // for faster computation
-	}
-	for (int index_sub_table = 0; index_sub_table < SUBTABLES_PER_WAVETABLE; ++index_sub_table) {
-		for (int index_position = 0; index_position < WAVETABLE_LENGTH; ++index_position) {
-			m_wavedraw_tables[p_table_nr][index_sub_table][index_position] *= max;
+		// low subtables are all cut at the same harmonic
+		if (number_of_harmonics == last_number_harmonics) {
+			memcpy(sub_table, sub_table - WAVETABLE_LENGTH, WAVETABLE_LENGTH * sizeof(float));
+			continue;
 		}
-	}
-}
-
-void WavetableContainer::createSpecdrawTable(int p_table_nr,
-                                             float p_specdraw_values[SPECDRAW_STEPS_X],
-                                             float p_samplerate) {
-	// now create the wavetable from the fourier coefficients
-	double seed_freq = 27.5; // A0
-	float max        = 0.f;
+		last_number_harmonics = number_of_harmonics;
 
-	// delete old table
-	memset(m_specdraw_tables[p_table_nr], 0, SUBTABLES_PER_WAVETABLE * WAVETABLE_LENGTH * sizeof(float));
-
-	// loop over subtables
-	for (int index_sub_table = 0; index_sub_table < SUBTABLES_PER_WAVETABLE; ++index_sub_table) {
-
-		// how many harmonics are needed for this subtable
-		int number_of_harmonics = (int)((p_samplerate * 0.5f / seed_freq) - 1);
-
-		number_of_harmonics = number_of_harmonics > SPECDRAW_STEPS_X + 1 ? SPECDRAW_STEPS_X + 1 : number_of_harmonics;
+		// bin k = N/2 * (cos_k - i * sin_k) gives sin_k * sin(2 pi k n / N) + cos_k * cos(2 pi k n / N)
+		memset(spectrum, 0, sizeof(spectrum));
+		for (int index_harmonics = 1; index_harmonics < number_of_harmonics; ++index_harmonics) {
+			spectrum[2 * index_harmonics]     = p_coefficients[1][index_harmonics] * WAVETABLE_LENGTH * 0.5f;
+			spectrum[2 * index_harmonics + 1] = -p_coefficients[0][index_harmonics] * WAVETABLE_LENGTH * 0.5f;
+		}
+		p_fft.performRealOnlyInverseTransform(spectrum);
 
 		for (int index_position = 0; index_position < WAVETABLE_LENGTH; ++index_position) {
-			for (int index_harmonics = 1; index_harmonics < number_of_harmonics; ++index_harmonics) {
-
-				// fill table with
-				// sine harmonics
-				m_specdraw_tables[p_table_nr][index_sub_table][index_position] +=
-				    p_specdraw_values[index_harmonics - 1] * m_specdraw_scalar[index_harmonics - 1] *
-				    sin(2.f * PI * index_position * index_harmonics / (float)WAVETABLE_LENGTH);
-			}
+			sub_table[index_position] = spectrum[index_position];
 			// find max among all tables
-			if (fabs(m_specdraw_tables[p_table_nr][index_sub_table][index_position]) > max) {
-				max = fabs(m_specdraw_tables[p_table_nr][index_sub_table][index_position]);
+			if (fabs(spectrum[index_position]) > max) {
+				max = fabs(spectrum[index_position]);
 			}
 		}
-		// increment seed frequency by minor third = 2^(3/12)
-		seed_freq *= 1.1892071150;
-
-		// set pointers
-		m_specdraw_pointers[p_table_nr][index_sub_table] = m_specdraw_tables[p_table_nr][index_sub_table];
 	}
 
 	// do another round to scale the table
@@ -402,10 +469,8 @@ void WavetableContainer::createSpecdrawTable(int p_table_nr,
 	if (max > 1e-5) {
 		max = 1.f / max; // for faster computation
 	}
-	for (int index_sub_table = 0; index_sub_table < SUBTABLES_PER_WAVETABLE; ++index_sub_table) {
-		for (int index_position = 0; index_position < WAVETABLE_LENGTH; ++index_position) {
-			m_specdraw_tables[p_table_nr][index_sub_table][index_position] *= max;
-		}
+	for (int index = 0; index < SUBTABLES_PER_WAVETABLE * WAVETABLE_LENGTH; ++index) {
+		p_table[index] *= max;
 	}
 }
 
@@ -466,80 +531,90 @@ float **WavetableContainer::getSpecdrawPointer(int p_specdraw_index) {
 	return m_specdraw_pointers[p_specdraw_index];
 }
 
-const float **WavetableContainer::getWavetablePointers(int p_wavetable) {
-	return m_const_wavetable_pointers[p_wavetable];
+const float *const *WavetableContainer::getWavetablePointers(int p_wavetable) {
+	return m_factory_wavetables->getSubtables(p_wavetable);
 }
 
-const float **WavetableContainer::getWavetablePointers(const std::string &p_name) {
-	// for(int wt = 0; wt < NUMBER_OF_WAVETABLES; ++wt){
-	//     if(p_name == m_wavetable_names_1D[wt]){
-	//         return m_wavetable_pointers[wt];
-	//     }
-	// }
-
-	auto it = m_name_index_map.find(p_name);
-	if (it != m_name_index_map.end()) {
-		return m_const_wavetable_pointers[it->second];
-	}
-
-	
-	return m_const_wavetable_pointers[0]; // return sine if no wt found
-}
-
-const float **WavetableContainer::getLFOPointers(const std::string &p_name) {
-	auto it = m_LFO_name_index_map.find(p_name);
-	if (it != m_LFO_name_index_map.end()) {
-		return m_const_LFO_pointers[it->second];
-	}
-	DBG("Couldn't find LFO table " + p_name);
-	return m_const_LFO_pointers[0];
+const float **WavetableContainer::getLFOPointers(int p_lfo_table) {
+	return m_const_LFO_pointers[p_lfo_table];
 }
 
 void WavetableContainer::loadWavetablesFromConstData() {
 
-	for (int index_wavetable = 0; index_wavetable < NUMBER_OF_WAVETABLES; ++index_wavetable) {
-
-		for (int index_subtable = 0; index_subtable < SUBTABLES_PER_WAVETABLE; ++index_subtable) {
-			m_const_wavetable_pointers[index_wavetable][index_subtable] =
-			    getOneSubTable(index_wavetable, index_subtable);
-		}
-		m_name_index_map.insert(std::pair<std::string, int>(m_wavetable_names_1D[index_wavetable], index_wavetable));
-		//String DEBUG_LIST_FUCK = "";
-
-	//for (auto it = m_name_index_map.begin(); it != m_name_index_map.end(); it++) {
-	//	DEBUG_LIST_FUCK = DEBUG_LIST_FUCK + it->first + ", ";
-	//}
-
-	//DBG("COULDN'T FIND WAVETABLE WITH NAME " + p_name);
-	//AlertWindow::showMessageBox(
-	  //  AlertWindow::AlertIconType::WarningIcon,  " MAPSIZE AT: "+String(m_wavetable_names_1D[index_wavetable]) +"..." + String(m_name_index_map.size()), DEBUG_LIST_FUCK, m_wavetable_names_1D[index_wavetable]);
-	}
+	m_factory_wavetables = WavetableStore::getWavetables(WAVETABLE_CONST_DATA_SAMPLERATE);
+	m_samplerate         = WAVETABLE_CONST_DATA_SAMPLERATE;
 
 	for (int index_wavetable = 0; index_wavetable < NUMBER_OF_WAVETABLES; ++index_wavetable) {
 
 		int index_subtable                                    = 0;
 		m_const_LFO_pointers[index_wavetable][index_subtable] = getOneLFOTable(index_wavetable);
-		m_LFO_name_index_map.insert(std::pair<std::string, int>(m_LFO_names[index_wavetable], index_wavetable));
 	}
-}
 
-void WavetableContainer::loadWavetablesAfterFourierCreation() {
+	load2DWavetables();
+}
 
-	for (int index_wavetable = 0; index_wavetable < NUMBER_OF_WAVETABLES; ++index_wavetable) {
+void WavetableContainer::loadWavetablesForSampleRate(float p_samplerate) {
+	m_factory_wavetables = WavetableStore::getWavetables(p_samplerate);
+	m_samplerate         = p_samplerate;
+	load2DWavetables();
+}
 
-		for (int index_subtable = 0; index_subtable < SUBTABLES_PER_WAVETABLE; ++index_subtable) {
-			// m_const_wavetable_pointers[index_wavetable][index_subtable] =
-			// getOneSubTable(index_wavetable, index_subtable);
-			m_const_wavetable_pointers[index_wavetable][index_subtable] = m_wavetables[index_wavetable][index_subtable];
+// the 1D tables which make up each 2D wavetable, the remaining 2D wavetables are unused and read sines
+static constexpr int WAVETABLE_2D_IDS[NUMBER_OF_WAVETABLES_2D][TABLES_PER_2D_WT] = {
+	{WavetableID::Saw, WavetableID::ChiptuneSquare50, WavetableID::Triangle, WavetableID::Sine},
+	{WavetableID::AKWF_birds_0010, WavetableID::AKWF_birds_0011, WavetableID::AKWF_birds_0014, WavetableID::AKWF_birds_0004},
+	{WavetableID::BagPipe, WavetableID::BagPipeMutated1, WavetableID::BagPipeMutated5, WavetableID::BagPipeMutated4},
+	{WavetableID::Glass, WavetableID::GlassMutated1, WavetableID::GlassMutated2, WavetableID::GlassMutated3},
+	{WavetableID::AKWF_fmsynth_0011, WavetableID::AKWF_fmsynth_0032, WavetableID::AKWF_fmsynth_0034, WavetableID::AKWF_fmsynth_0081},
+	{WavetableID::BrokenSine1, WavetableID::BrokenSine2, WavetableID::BrokenSine3, WavetableID::BrokenSine4},
+	{WavetableID::Skyline1, WavetableID::Skyline2, WavetableID::Skyline3, WavetableID::Skyline4},
+	{WavetableID::PerlinReplace1, WavetableID::PerlinReplace2, WavetableID::PerlinReplace3, WavetableID::PerlinReplace4},
+	{WavetableID::Rectangular1, WavetableID::Rectangular2, WavetableID::Rectangular3, WavetableID::Rectangular4},
+	{WavetableID::AKWF_bitreduced_0002, WavetableID::AKWF_bitreduced_0003, WavetableID::AKWF_bitreduced_0006, WavetableID::AKWF_bitreduced_0011},
+	{WavetableID::Violin1, WavetableID::Violin2, WavetableID::Cello1, WavetableID::Cello2},
+	{WavetableID::Piano2, WavetableID::Piano3, WavetableID::Piano4, WavetableID::Piano1},
+	{WavetableID::Organ1, WavetableID::Organ2, WavetableID::Organ3, WavetableID::Organ4},
+	{WavetableID::Oboe1, WavetableID::Oboe2, WavetableID::Oboe3, WavetableID::Oboe4},
+	{WavetableID::Trumpet1, WavetableID::Trumpet2, WavetableID::Trumpet3, WavetableID::Trumpet4},
+	{WavetableID::LegToyBox, WavetableID::LegRip2, WavetableID::LegMale, WavetableID::LegBarbedWire},
+	{WavetableID::LegAdd8, WavetableID::LegSharp, WavetableID::LegPiano, WavetableID::LegAdd1},
+	{WavetableID::LegCello, WavetableID::LegAah, WavetableID::LegHarm2, WavetableID::LegNoBass},
+	{WavetableID::LegBags, WavetableID::LegOrgan, WavetableID::LegTriQuad, WavetableID::LegAdd3},
+	{WavetableID::AKWF_hvoice_0002, WavetableID::AKWF_hvoice_0010, WavetableID::AKWF_hvoice_0014, WavetableID::AKWF_hvoice_0019},
+	{WavetableID::AKWF_hvoice_0020, WavetableID::AKWF_hvoice_0021, WavetableID::AKWF_hvoice_0029, WavetableID::AKWF_hvoice_0032},
+	{WavetableID::AKWF_hvoice_0037, WavetableID::AKWF_hvoice_0041, WavetableID::AKWF_hvoice_0047, WavetableID::AKWF_hvoice_0049},
+	{WavetableID::AKWF_hvoice_0056, WavetableID::AKWF_hvoice_0064, WavetableID::AKWF_hvoice_0071, WavetableID::AKWF_hvoice_0093},
+	{WavetableID::Additive1, WavetableID::Additive2, WavetableID::Additive3, WavetableID::Additive4},
+	{WavetableID::Additive5, WavetableID::Additive6, WavetableID::Additive7, WavetableID::Additive8},
+	{WavetableID::Additive10, WavetableID::Additive11, WavetableID::Additive12, WavetableID::Additive9},
+	{WavetableID::Additive13, WavetableID::Additive14, WavetableID::Additive15, WavetableID::Additive16},
+	{WavetableID::Harmonics9, WavetableID::Harmonics10, WavetableID::Harmonics11, WavetableID::Harmonics12}, // overtones 1-4
+	{WavetableID::Harmonics13, WavetableID::Harmonics14, WavetableID::Harmonics15, WavetableID::Harmonics16}, // overtones 5-9
+	{WavetableID::Harmonics5, WavetableID::Harmonics6, WavetableID::Harmonics7, WavetableID::Harmonics8},
+	{WavetableID::Harmonics1, WavetableID::Harmonics2, WavetableID::Harmonics3, WavetableID::Harmonics4},
+	{WavetableID::FatSawMutated1, WavetableID::FatSawMutated2, WavetableID::FatSawMutated3, WavetableID::FatSawMutated4},
+	{WavetableID::FatSawMutated5, WavetableID::FatSawMutated6, WavetableID::FatSawMutated7, WavetableID::FatSawMutated8},
+	{WavetableID::ChiptuneSquare50Mutated1, WavetableID::ChiptuneSquare50Mutated2, WavetableID::ChiptuneSquare50Mutated3, WavetableID::ChiptuneSquare50Mutated4},
+	{WavetableID::ChiptuneSquare50Mutated5, WavetableID::ChiptuneSquare50Mutated6, WavetableID::ChiptuneSquare50Mutated7, WavetableID::ChiptuneSquare50Mutated8},
+};
+
+void WavetableContainer::load2DWavetables() {
+	for (int wavetable_2D = 0; wavetable_2D < NUMBER_OF_WAVETABLES_2D; ++wavetable_2D) {
+		for (int table_2D = 0; table_2D < TABLES_PER_2D_WT; ++table_2D) {
+			const float *const *subtables = getWavetablePointers(WAVETABLE_2D_IDS[wavetable_2D][table_2D]);
+			for (int sub_table = 0; sub_table < SUBTABLES_PER_WAVETABLE; ++sub_table) {
+				m_wavetable_pointers_2D[wavetable_2D][sub_table][table_2D] = subtables[sub_table];
+			}
 		}
-		m_name_index_map.insert(std::pair<std::string, int>(m_wavetable_names_1D[index_wavetable], index_wavetable));
 	}
 }
 
+// only used for debugging, the oscs use the ids from WavetableIDs.h
 int WavetableContainer::getWavetableIndexFromName(const std::string &p_name) {
-	auto it = m_name_index_map.find(p_name);
-	if (it != m_name_index_map.end()) {
-		return it->second;
+	for (int index_wavetable = 0; index_wavetable < NUMBER_OF_WAVETABLES; ++index_wavetable) {
+		if (p_name == WAVETABLE_NAMES_1D[index_wavetable]) {
+			return index_wavetable;
+		}
 	}
 	DBG("getWavetableIndexFromName(): COULDNT FIND WT WITH NAME " + p_name);
 	return 0;
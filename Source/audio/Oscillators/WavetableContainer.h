@@ -18,11 +18,19 @@
 
 #include "../../GlobalIncludes.h"
 #include "../OdinConstants.h"
+#include "WavetableStore.h"
+#include "Wavetables/WavetableIDs.h"
 #include "Wavetables/Tables/LFOTableData.h"
 #include "Wavetables/Tables/WavetableData.h"
-#include <map>
+#include <atomic>
+#include <memory>
 #include <string>
 
+#define NUMBER_OF_DRAW_TABLE_SLOTS (NUMBER_OF_WAVEDRAW_TABLES + NUMBER_OF_CHIPDRAW_TABLES + NUMBER_OF_SPECDRAW_TABLES)
+
+// subtable pointers of the TABLES_PER_2D_WT tables of one 2D wavetable
+typedef const float *Wavetable2DPointers[SUBTABLES_PER_WAVETABLE][TABLES_PER_2D_WT];
+
 class WavetableContainer {
 public:
 
@@ -40,12 +48,12 @@ public:
 
   void loadWavetablesFromConstData(); // assign pointers to wavetables from
                                       // files directly
-  void loadWavetablesAfterFourierCreation(); // assign pointers to wavetables
-                                             // from files directly
   void createWavetables(float p_samplerate); // create and allocate memory from
                                              // coefficients and assign pointers
   void createLFOtables(float p_samplerate);
 
+  // these build the draw table on the calling thread and point the oscs
+  // to it directly. Only use them while no audio is rendered
   void createChipdrawTable(int p_table_nr, float p_chipdraw_values[32],
                            float p_samplerate);
   void createWavedrawTable(int p_table_nr,
@@ -55,12 +63,50 @@ public:
                            float p_fourier_values[SPECDRAW_STEPS_X],
                            float p_samplerate);
 
-  const float **getWavetablePointers(int p_wavetable);
-  const float **getWavetablePointers(const std::string &p_name);
+  // these hand the draw table to the background builder. The finished table
+  // is picked up by the audio thread in installDrawTables()
+  void requestChipdrawTable(int p_table_nr,
+                            float p_chipdraw_values[CHIPDRAW_STEPS_X],
+                            float p_samplerate);
+  void requestWavedrawTable(int p_table_nr,
+                            float p_wavedraw_values[WAVEDRAW_STEPS_X],
+                            float p_samplerate, bool p_const_sections = false);
+  void requestSpecdrawTable(int p_table_nr,
+                            float p_specdraw_values[SPECDRAW_STEPS_X],
+                            float p_samplerate);
+
+  // builds the requested draw tables which the background builder didn't
+  // get to yet on the calling thread. Afterwards the next
+  // installDrawTables() picks up all of them
+  void finishDrawTables();
+
+  // call from the audio thread between blocks. Points the oscs to the draw
+  // tables which were finished since the last call, nothing is copied.
+  // Returns true if any table changed
+  bool installDrawTables();
+
+  // switches to the 1D wavetables band limited for p_samplerate. They are
+  // shared with all other instances, see WavetableStore. The oscs have to
+  // reload their pointers afterwards, so don't call this while audio is
+  // rendered
+  void loadWavetablesForSampleRate(float p_samplerate);
+  // the samplerate the tables are currently band limited for
+  float getSampleRate() { return m_samplerate; }
+
+  // SUBTABLES_PER_WAVETABLE pointers, valid until the next
+  // loadWavetablesForSampleRate()
+  // p_wavetable is one of WavetableID
+  const float *const *getWavetablePointers(int p_wavetable);
+  // NUMBER_OF_WAVETABLES_2D entries, shared by all 2D oscs. Valid until the
+  // next loadWavetablesForSampleRate()
+  const Wavetable2DPointers *getWavetable2DPointers() {
+    return m_wavetable_pointers_2D;
+  }
   float **getChipdrawPointer(int p_chipdraw_index);
   float **getWavedrawPointer(int p_wavedraw_index);
   float **getSpecdrawPointer(int p_specdraw_index);
-  const float **getLFOPointers(const std::string &p_name);
+  // p_lfo_table is one of LFOTableID
+  const float **getLFOPointers(int p_lfo_table);
 
   int getWavetableIndexFromName(const std::string &p_name);
 
@@ -68,6 +114,74 @@ private:
   //WavetableContainer();
 
 protected:
+  typedef float DrawTable[SUBTABLES_PER_WAVETABLE][WAVETABLE_LENGTH];
+
+  enum DrawTableType { Wavedraw = 0, Chipdraw = 1, Specdraw = 2 };
+
+  // copy of the drawn values, written by the GUI and read by the builder
+  struct DrawTableRequest {
+    float values[WAVEDRAW_STEPS_X]; // large enough for every draw type
+    float samplerate    = 44100.f;
+    bool const_sections = false;
+    bool pending        = false;
+  };
+
+  // builds requested draw tables away from the message and audio thread
+  class DrawTableWorker : public Thread {
+  public:
+    DrawTableWorker(WavetableContainer &p_container)
+        : Thread("Odin Draw Table Builder"), m_container(p_container),
+          m_fft(WAVETABLE_FFT_ORDER) {}
+    void run() override;
+
+  private:
+    WavetableContainer &m_container;
+    dsp::FFT m_fft;
+  };
+
+  // assigns the 1D tables which make up the 2D wavetables
+  void load2DWavetables();
+
+  int drawTableSlot(int p_type, int p_table_nr) {
+    return p_type * NUMBER_OF_WAVEDRAW_TABLES + p_table_nr;
+  }
+  // the oscs read a draw table through these SUBTABLES_PER_WAVETABLE
+  // pointers, so a new table is installed by setting them
+  float **getDrawPointers(int p_type, int p_table_nr);
+  void pointToDrawTable(int p_type, int p_table_nr, DrawTable &p_table);
+
+  void requestDrawTable(int p_type, int p_table_nr, const float *p_values,
+                        int p_number_of_values, float p_samplerate,
+                        bool p_const_sections);
+  void buildRequestedDrawTables(dsp::FFT &p_fft);
+
+  // fourier coefficients of the drawn values
+  void chipdrawCoefficients(const float *p_chipdraw_values,
+                            float p_coefficients[SIN_AND_COS]
+                                                [NUMBER_OF_HARMONICS]);
+  void wavedrawCoefficients(const float *p_wavedraw_values,
+                            bool p_const_sections,
+                            float p_coefficients[SIN_AND_COS]
+                                                [NUMBER_OF_HARMONICS]);
+  void specdrawCoefficients(const float *p_specdraw_values,
+                            float p_coefficients[SIN_AND_COS]
+                                                [NUMBER_OF_HARMONICS]);
+  void buildDrawTable(dsp::FFT &p_fft, int p_type, const float *p_values,
+                      float p_samplerate, bool p_const_sections,
+                      DrawTable &p_table);
+
+public:
+  // one inverse fft per subtable, with the spectrum cut off at nyquist of
+  // the subtable's highest frequency. All subtables are normalized together.
+  // p_table holds SUBTABLES_PER_WAVETABLE * WAVETABLE_LENGTH values
+  static void buildBandLimitedTable(dsp::FFT &p_fft,
+                                    float p_coefficients[SIN_AND_COS]
+                                                        [NUMBER_OF_HARMONICS],
+                                    int p_max_harmonics, float p_samplerate,
+                                    float *p_table);
+
+protected:
+
 // Fourrier Coefficients
 
   //float m_fourier_coeffs[NUMBER_OF_WAVETABLES][SIN_AND_COS]
@@ -86,16 +200,15 @@ protected:
   float lin_segment_one_overtone_cosine(float p_a, float p_b, float p_fa,
                                         float p_fb, int p_ot);
 
-  std::map<std::string, int> m_name_index_map;
-  std::map<std::string, int> m_LFO_name_index_map;
 
   //float m_LFO_fourier_coeffs[NUMBER_OF_LFOTABLES][SIN_AND_COS]
   //                          [NUMBER_OF_HARMONICS] = {
   //                              0}; // index [x][1][0] will store scalar, since
                                     // it is usually constant offset
 
-  const float *m_const_wavetable_pointers[NUMBER_OF_WAVETABLES]
-                                         [SUBTABLES_PER_WAVETABLE];
+  // factory tables, shared between instances
+  std::shared_ptr<const WavetableSet> m_factory_wavetables;
+  Wavetable2DPointers m_wavetable_pointers_2D[NUMBER_OF_WAVETABLES_2D] = {};
   const float *m_const_LFO_pointers[NUMBER_OF_WAVETABLES][1];
 
   // Wavetable pointers
@@ -119,10 +232,29 @@ protected:
   // specdraw scalar (1/sqrt(harmonic))
   float m_specdraw_scalar[SPECDRAW_STEPS_X];
 
-  std::string m_wavetable_names_1D[NUMBER_OF_WAVETABLES];
-  std::string m_LFO_names[NUMBER_OF_WAVETABLES];
 
   bool m_wavetables_created = false;
 
-  float ***m_wavetables; // dynamic allocation
+  float m_samplerate = WAVETABLE_CONST_DATA_SAMPLERATE;
+
+  // used by the create...Table() functions
+  dsp::FFT m_fft{WAVETABLE_FFT_ORDER};
+
+  // triple buffer per draw table: the builder writes the back buffer and
+  // swaps it with the middle one, the audio thread swaps the middle buffer
+  // with its front buffer if it is marked as new. Neither side ever waits.
+  // The buffers of a slot are allocated by the builder on its first request
+  std::unique_ptr<DrawTable[]> m_draw_buffers[NUMBER_OF_DRAW_TABLE_SLOTS];
+  std::atomic<int> m_draw_buffer_middle[NUMBER_OF_DRAW_TABLE_SLOTS];
+  int m_draw_buffer_back[NUMBER_OF_DRAW_TABLE_SLOTS];
+  int m_draw_buffer_front[NUMBER_OF_DRAW_TABLE_SLOTS];
+
+  DrawTableRequest m_draw_requests[NUMBER_OF_DRAW_TABLE_SLOTS];
+  CriticalSection m_draw_request_lock;
+  // held while building, so the builder and finishDrawTables() don't write
+  // the same back buffer
+  CriticalSection m_draw_build_lock;
+
+  // declared last, so it is the first member to be destroyed
+  DrawTableWorker m_draw_table_worker{*this};
 };
@@ -34,10 +34,7 @@ void WavetableOsc1D::reset() {
 
 	//DBG("reset WT");
 
-	// downsampling filter buffers
-	for (int i = 0; i < 10; ++i) {
-		xv[i] = yv[i] = 0;
-	}
+	m_sync_oversampler.reset();
 }
 
 void WavetableOsc1D::update() {
@@ -98,19 +95,13 @@ float WavetableOsc1D::doOscillate() {
 	return doWavetable();
 }
 
-void WavetableOsc1D::setWavetablePointer(int p_wavetable_index,
-                                         const float *p_wavetable_pointers[SUBTABLES_PER_WAVETABLE]) {
-	for (int sub_table = 0; sub_table < SUBTABLES_PER_WAVETABLE; sub_table++) {
-		m_wavetable_pointers[p_wavetable_index][sub_table] = p_wavetable_pointers[sub_table];
-	}
+void WavetableOsc1D::setWavetablePointer(int p_wavetable_index, const float *const *p_wavetable_pointers) {
+	m_wavetable_pointers[p_wavetable_index] = p_wavetable_pointers;
 }
 
 // nonconst is needed for draw tables
-void WavetableOsc1D::setWavetablePointerNONCONST(int p_wavetable_index,
-                                                 float *p_wavetable_pointers[SUBTABLES_PER_WAVETABLE]) {
-	for (int sub_table = 0; sub_table < SUBTABLES_PER_WAVETABLE; sub_table++) {
-		m_wavetable_pointers[p_wavetable_index][sub_table] = p_wavetable_pointers[sub_table];
-	}
+void WavetableOsc1D::setWavetablePointerNONCONST(int p_wavetable_index, float **p_wavetable_pointers) {
+	m_wavetable_pointers[p_wavetable_index] = p_wavetable_pointers;
 }
 
 void WavetableOsc1D::selectWavetable(int p_wavetable_index) {
@@ -155,96 +146,26 @@ void WavetableOsc1D::initiateSync() {
 	m_read_index = m_sync_oscillator->m_reset_position;
 }
 
-float WavetableOsc1D::doOscillateWithSync() {
+void WavetableOsc1D::doOscillateSynced(float *p_upsampled) {
     jassert(m_samplerate > 0);
+	jassert(isSynced());
 
-	// do sync shit: 3x oversampling for AA
-	if (m_sync_enabled && m_sync_oscillator) {
-		// check if a new reset flag was set:
-		if (m_sync_oscillator->m_reset_flag) {
-			initiateSync();
-		}
-		m_sync_anti_aliasing_inc_factor = 0.3333333f;
-
-		float input_upsampled[3] = {doOscillate(), doOscillate(), doOscillate()};
-
-		xv[0] = xv[1];
-		xv[1] = xv[2];
-		xv[2] = xv[3];
-		xv[3] = xv[4];
-		xv[4] = xv[5];
-		xv[5] = xv[6];
-		xv[6] = xv[7];
-		xv[7] = xv[8];
-		xv[8] = xv[9];
-		xv[9] = input_upsampled[0] * 0.019966841051093;
-		yv[0] = yv[1];
-		yv[1] = yv[2];
-		yv[2] = yv[3];
-		yv[3] = yv[4];
-		yv[4] = yv[5];
-		yv[5] = yv[6];
-		yv[6] = yv[7];
-		yv[7] = yv[8];
-		yv[8] = yv[9];
-		yv[9] = (xv[0] + xv[9]) + 9 * (xv[1] + xv[8]) + 36 * (xv[2] + xv[7]) + 84 * (xv[3] + xv[6]) +
-		        126 * (xv[4] + xv[5]) + (-0.0003977153 * yv[0]) + (-0.0064474617 * yv[1]) + (-0.0476997403 * yv[2]) +
-		        (-0.2185829743 * yv[3]) + (-0.6649234123 * yv[4]) + (-1.4773657709 * yv[5]) + (-2.2721421641 * yv[6]) +
-		        (-2.6598673212 * yv[7]) + (-1.8755960587 * yv[8]);
-		// next output value = yv[9];
-		xv[0] = xv[1];
-		xv[1] = xv[2];
-		xv[2] = xv[3];
-		xv[3] = xv[4];
-		xv[4] = xv[5];
-		xv[5] = xv[6];
-		xv[6] = xv[7];
-		xv[7] = xv[8];
-		xv[8] = xv[9];
-		xv[9] = input_upsampled[1] * 0.019966841051093;
-		yv[0] = yv[1];
-		yv[1] = yv[2];
-		yv[2] = yv[3];
-		yv[3] = yv[4];
-		yv[4] = yv[5];
-		yv[5] = yv[6];
-		yv[6] = yv[7];
-		yv[7] = yv[8];
-		yv[8] = yv[9];
-		yv[9] = (xv[0] + xv[9]) + 9 * (xv[1] + xv[8]) + 36 * (xv[2] + xv[7]) + 84 * (xv[3] + xv[6]) +
-		        126 * (xv[4] + xv[5]) + (-0.0003977153 * yv[0]) + (-0.0064474617 * yv[1]) + (-0.0476997403 * yv[2]) +
-		        (-0.2185829743 * yv[3]) + (-0.6649234123 * yv[4]) + (-1.4773657709 * yv[5]) + (-2.2721421641 * yv[6]) +
-		        (-2.6598673212 * yv[7]) + (-1.8755960587 * yv[8]);
-		// next output value = yv[9];
-		xv[0] = xv[1];
-		xv[1] = xv[2];
-		xv[2] = xv[3];
-		xv[3] = xv[4];
-		xv[4] = xv[5];
-		xv[5] = xv[6];
-		xv[6] = xv[7];
-		xv[7] = xv[8];
-		xv[8] = xv[9];
-		xv[9] = input_upsampled[2] * 0.019966841051093;
-		yv[0] = yv[1];
-		yv[1] = yv[2];
-		yv[2] = yv[3];
-		yv[3] = yv[4];
-		yv[4] = yv[5];
-		yv[5] = yv[6];
-		yv[6] = yv[7];
-		yv[7] = yv[8];
-		yv[8] = yv[9];
-		yv[9] = (xv[0] + xv[9]) + 9 * (xv[1] + xv[8]) + 36 * (xv[2] + xv[7]) + 84 * (xv[3] + xv[6]) +
-		        126 * (xv[4] + xv[5]) + (-0.0003977153 * yv[0]) + (-0.0064474617 * yv[1]) + (-0.0476997403 * yv[2]) +
-		        (-0.2185829743 * yv[3]) + (-0.6649234123 * yv[4]) + (-1.4773657709 * yv[5]) + (-2.2721421641 * yv[6]) +
-		        (-2.6598673212 * yv[7]) + (-1.8755960587 * yv[8]);
-
-		return m_dc_blocking_filter.doFilter(yv[9]);
-
-	} else {
-		// either sync off or syncosc not set:
-		m_sync_anti_aliasing_inc_factor = 1.f;
-		return doOscillate();
+	// check if a new reset flag was set:
+	if (m_sync_oscillator->m_reset_flag) {
+		initiateSync();
+	}
+	// the osc runs at the oversampled rate
+	const int factor                = m_sync_oversampler.getFactor();
+	m_sync_anti_aliasing_inc_factor = 1.f / (float)factor;
+	for (int sample = 0; sample < factor; ++sample) {
+		p_upsampled[sample] = doOscillate();
+	}
+	m_sync_anti_aliasing_inc_factor = 1.f;
+}
+
+void WavetableOsc1D::downsampleSync(const float *p_upsampled, float *p_output, int p_num_samples) {
+	m_sync_oversampler.downsample(p_upsampled, p_output, p_num_samples);
+	for (int sample = 0; sample < p_num_samples; ++sample) {
+		p_output[sample] = m_dc_blocking_filter.doFilter(p_output[sample]);
 	}
 }
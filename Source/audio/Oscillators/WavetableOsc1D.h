@@ -15,6 +15,7 @@
 
 #pragma once
 #include "../Filters/DCBlockingFilter.h"
+#include "../Filters/Oversampler.h"
 #include "../OdinConstants.h"
 #include "Oscillator.h"
 #include "WavetableContainer.h"
@@ -23,6 +24,8 @@
 #define SYNC_PORTION_OF_TABLE 16 // sync smoothing takes place 1/16th of a table
 
 class WavetableOsc1D : public Oscillator {
+	friend class WavetableOscBank;
+
 public:
 	// this shall map wavetables properly.
 	// Input: wavetable index from valueTree (propably from dropdown menu)
@@ -43,9 +46,11 @@ public:
 	virtual float doOscillate() override;
 	virtual void update() override;
 
-	// this function is used to support sync for all deriving classes.
-	// It does the sync stuff and then calls doOscillate (from child classes)
-	float doOscillateWithSync();
+	// these functions support sync for all deriving classes. A synced osc runs at the oversampled rate:
+	// doOscillateSynced() renders the getSyncOversamplingFactor() samples of one base rate sample, after the
+	// sub-block downsampleSync() brings all of them back to the base rate at once
+	void doOscillateSynced(float *p_upsampled);
+	void downsampleSync(const float *p_upsampled, float *p_output, int p_num_samples);
 
 	// used to load wavetables can be overwritten by child classes
 	virtual void loadWavetables();
@@ -67,6 +72,24 @@ public:
 		m_sync_enabled = p_sync;
 	}
 
+	// only the downsampling half of the oversampler is used, the osc itself runs at the high rate
+	void setSyncOversampling(int p_factor, Oversampler::Quality p_quality) {
+		m_sync_oversampler.setup(p_factor, p_quality);
+	}
+
+	bool isSynced() const {
+		return m_sync_enabled && m_sync_oscillator;
+	}
+
+	int getSyncOversamplingFactor() const {
+		return m_sync_oversampler.getFactor();
+	}
+
+	// true if the osc is rendered by a plain doWavetable(), so it can be rendered by WavetableOscBank
+	bool isPlainWavetable() const {
+		return !isSynced();
+	}
+
 	void setSampleRate(float p_sr) override {
 		Oscillator::setSampleRate(p_sr);
 		m_dc_blocking_filter.setSampleRate(p_sr);
@@ -81,8 +104,8 @@ protected:
 
 	virtual int getTableIndex();
 
-	void setWavetablePointer(int p_wavetable_index, const float *p_wavetable_pointers[SUBTABLES_PER_WAVETABLE]);
-	void setWavetablePointerNONCONST(int p_wavetable_index, float *p_wavetable_pointers[SUBTABLES_PER_WAVETABLE]);
+	void setWavetablePointer(int p_wavetable_index, const float *const *p_wavetable_pointers);
+	void setWavetablePointerNONCONST(int p_wavetable_index, float **p_wavetable_pointers);
 
 	inline float linearInterpolation(float p_low, float p_high, float p_distance) {
 		//return (1.f - p_distance) * p_low + p_distance * p_high;
@@ -120,13 +143,12 @@ protected:
 	Oscillator *m_sync_oscillator         = nullptr;
 	float m_sync_anti_aliasing_inc_factor = 1.f;
 
-	// downsampling filter (see distortion for details)
-	double xv[10] = {0.};
-	double yv[10] = {0.};
+	// downsampling filter
+	Oversampler m_sync_oversampler;
 
 	// tables
-	const float *m_wavetable_pointers[NUMBER_OF_WAVETABLES + 9] //+ 9 for drawtables
-	                                 [SUBTABLES_PER_WAVETABLE];
+	// one row of SUBTABLES_PER_WAVETABLE pointers per wavetable, owned by the WavetableContainer
+	const float *const *m_wavetable_pointers[NUMBER_OF_WAVETABLES + 9] = {nullptr}; //+ 9 for drawtables
 	const float *m_current_table;
 	int m_wavetable_index = 0;
 	int m_sub_table_index = 0;
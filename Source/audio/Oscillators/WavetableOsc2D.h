@@ -120,15 +120,11 @@ protected:
   //how much modenv is applied to position
   float m_pos_mod_control = 0.f;
   float m_pos_mod_value;
-  void setWavetablePointer(
-      int p_wavetable_index, int p_2D_sub_table,
-      const float *p_wavetable_pointers[SUBTABLES_PER_WAVETABLE]);
   float doWavetable2D();
 
 
 
-  const float
-      *m_wavetable_pointers_2D[NUMBER_OF_WAVETABLES_2D][SUBTABLES_PER_WAVETABLE]
-                              [TABLES_PER_2D_WT];
-  const float **m_current_table_2D;
+  // owned by the WavetableContainer, NUMBER_OF_WAVETABLES_2D entries
+  const Wavetable2DPointers *m_wavetable_pointers_2D = nullptr;
+  const float *const *m_current_table_2D;
 };
@@ -0,0 +1,93 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#include "WavetableOscBank.h"
+
+#if JUCE_INTEL && JUCE_64BIT
+#define ODIN_OSC_BANK_AVX2 1
+#include <immintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+#define ODIN_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define ODIN_TARGET_AVX2
+#endif
+#else
+#define ODIN_OSC_BANK_AVX2 0
+#endif
+
+static_assert((WAVETABLE_LENGTH & (WAVETABLE_LENGTH - 1)) == 0, "wavetable length must be a power of two");
+
+// same math as WavetableOsc1D::doWavetable(), but without branches so the lane loop vectorizes.
+// The increment is always smaller than a table length, so a single wrap is sufficient.
+static void renderLanesScalar(double *pio_phase, const double *p_inc, const float *const *p_table, float *p_output) {
+	for (int lane = 0; lane < OSC_BANK_LANES; ++lane) {
+		const int read_index_trunc = (int)pio_phase[lane];
+		const float fractional     = pio_phase[lane] - (double)read_index_trunc;
+		const int read_index_next  = (read_index_trunc + 1) & (WAVETABLE_LENGTH - 1);
+
+		const float low  = p_table[lane][read_index_trunc];
+		const float high = p_table[lane][read_index_next];
+		p_output[lane]   = fractional * (high - low) + low;
+
+		double phase = pio_phase[lane] + p_inc[lane];
+		phase += phase < 0. ? WAVETABLE_LENGTH : 0.;
+		phase -= phase >= WAVETABLE_LENGTH ? WAVETABLE_LENGTH : 0.;
+		pio_phase[lane] = phase;
+	}
+}
+
+#if ODIN_OSC_BANK_AVX2
+// every lane reads from its own table, so the gathers use absolute addresses with a null base pointer
+ODIN_TARGET_AVX2 static void
+renderLanesAVX2(double *pio_phase, const double *p_inc, const float *const *p_table, float *p_output) {
+	static_assert(OSC_BANK_LANES == 4, "AVX2 kernel is written for four lanes");
+
+	const __m256d length = _mm256_set1_pd(WAVETABLE_LENGTH);
+	const __m256d zero   = _mm256_setzero_pd();
+
+	__m256d phase = _mm256_loadu_pd(pio_phase);
+
+	const __m128i read_index_trunc = _mm256_cvttpd_epi32(phase);
+	const __m128i read_index_next =
+	    _mm_and_si128(_mm_add_epi32(read_index_trunc, _mm_set1_epi32(1)), _mm_set1_epi32(WAVETABLE_LENGTH - 1));
+	const __m128 fractional = _mm256_cvtpd_ps(_mm256_sub_pd(phase, _mm256_cvtepi32_pd(read_index_trunc)));
+
+	const __m256i tables    = _mm256_loadu_si256((const __m256i *)p_table);
+	const __m256i addr_low  = _mm256_add_epi64(tables, _mm256_slli_epi64(_mm256_cvtepi32_epi64(read_index_trunc), 2));
+	const __m256i addr_high = _mm256_add_epi64(tables, _mm256_slli_epi64(_mm256_cvtepi32_epi64(read_index_next), 2));
+
+	const __m128 low  = _mm256_i64gather_ps((const float *)nullptr, addr_low, 1);
+	const __m128 high = _mm256_i64gather_ps((const float *)nullptr, addr_high, 1);
+	_mm_storeu_ps(p_output, _mm_add_ps(_mm_mul_ps(fractional, _mm_sub_ps(high, low)), low));
+
+	// advance and wrap phase
+	phase                = _mm256_add_pd(phase, _mm256_loadu_pd(p_inc));
+	phase                = _mm256_add_pd(phase, _mm256_and_pd(_mm256_cmp_pd(phase, zero, _CMP_LT_OQ), length));
+	const __m256d wraps  = _mm256_cmp_pd(phase, length, _CMP_GE_OQ);
+	phase                = _mm256_sub_pd(phase, _mm256_and_pd(wraps, length));
+	_mm256_storeu_pd(pio_phase, phase);
+}
+#endif
+
+WavetableOscBank::WavetableOscBank() {
+	m_kernel = renderLanesScalar;
+#if ODIN_OSC_BANK_AVX2
+	if (SystemStats::hasAVX2()) {
+		m_kernel           = renderLanesAVX2;
+		m_uses_simd_kernel = true;
+	}
+#endif
+	DBG("WavetableOscBank uses " + String(m_uses_simd_kernel ? "AVX2" : "scalar") + " kernel");
+}
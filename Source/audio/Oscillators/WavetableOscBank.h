@@ -0,0 +1,90 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#pragma once
+#include "WavetableOsc1D.h"
+
+#define OSC_BANK_LANES 4
+
+// Renders the same osc slot of up to OSC_BANK_LANES voices in lockstep. The per voice update() (glide, pitch
+// modulation, subtable selection) stays scalar, the table read and phase increment of all lanes is done by
+// one kernel. The kernel is chosen at runtime: AVX2 gathers if the CPU has them, else a plain lane loop.
+// Only oscs which end up in WavetableOsc1D::doWavetable() without sync can be rendered here.
+class WavetableOscBank {
+public:
+	WavetableOscBank();
+
+	// renders p_num_samples into p_outputs[lane] for p_lanes oscs of type OscType
+	template <class OscType>
+	void render(OscType *p_oscs[OSC_BANK_LANES], float *p_outputs[OSC_BANK_LANES], int p_lanes, int p_num_samples) {
+		jassert(p_lanes > 0 && p_lanes <= OSC_BANK_LANES);
+
+		for (int lane = 0; lane < p_lanes; ++lane) {
+			p_oscs[lane]->m_sync_anti_aliasing_inc_factor = 1.f;
+			m_phase[lane]                                 = p_oscs[lane]->m_read_index;
+		}
+		// unused lanes read silence
+		for (int lane = p_lanes; lane < OSC_BANK_LANES; ++lane) {
+			m_phase[lane] = 0.;
+			m_inc[lane]   = 0.;
+			m_table[lane] = m_silent_table;
+		}
+
+		float output[OSC_BANK_LANES];
+		for (int sample = 0; sample < p_num_samples; ++sample) {
+			for (int lane = 0; lane < p_lanes; ++lane) {
+				// qualified call, so this is not dispatched virtually
+				p_oscs[lane]->OscType::update();
+				m_inc[lane]   = p_oscs[lane]->m_wavetable_inc;
+				m_table[lane] = p_oscs[lane]->m_current_table;
+			}
+
+			m_kernel(m_phase, m_inc, m_table, output);
+
+			for (int lane = 0; lane < p_lanes; ++lane) {
+				p_outputs[lane][sample] = output[lane];
+			}
+		}
+
+		// the reset flag only tells a hard synced osc that the phase wrapped on this very sample. Nothing syncs to
+		// the oscs rendered here, so it must not carry a wrap of this sub-block over to the next sample rendered
+		// elsewhere. Restarting the phase on a new note is done once by voiceStart() before the sub-block
+		for (int lane = 0; lane < p_lanes; ++lane) {
+			p_oscs[lane]->m_read_index = m_phase[lane];
+			p_oscs[lane]->m_reset_flag = false;
+		}
+	}
+
+	bool usesSIMDKernel() const {
+		return m_uses_simd_kernel;
+	}
+
+	// reads one sample of each lane, advances and wraps the phases
+	typedef void (*Kernel)(double *pio_phase,
+	                       const double *p_inc,
+	                       const float *const *p_table,
+	                       float *p_output);
+
+private:
+	// SoA state of the lanes
+	double m_phase[OSC_BANK_LANES]       = {0.};
+	double m_inc[OSC_BANK_LANES]         = {0.};
+	const float *m_table[OSC_BANK_LANES] = {nullptr};
+
+	Kernel m_kernel         = nullptr;
+	bool m_uses_simd_kernel = false;
+
+	float m_silent_table[WAVETABLE_LENGTH] = {0.f};
+};
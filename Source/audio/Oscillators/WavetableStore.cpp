@@ -0,0 +1,168 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#include "WavetableStore.h"
+#include "WavetableContainer.h"
+#include "Wavetables/Tables/WavetableData.h"
+#include <ctime>
+
+#define WAVETABLE_SET_SIZE (NUMBER_OF_WAVETABLES * SUBTABLES_PER_WAVETABLE * WAVETABLE_LENGTH)
+
+CriticalSection &WavetableStore::getLock() {
+	static CriticalSection lock;
+	return lock;
+}
+
+std::map<int, std::weak_ptr<const WavetableSet>> &WavetableStore::getSets() {
+	static std::map<int, std::weak_ptr<const WavetableSet>> sets;
+	return sets;
+}
+
+std::shared_ptr<const WavetableSet> WavetableStore::getWavetables(float p_samplerate) {
+	const ScopedLock lock(getLock());
+
+	auto &weak_set = getSets()[(int)p_samplerate];
+	if (auto set = weak_set.lock()) {
+		return set;
+	}
+
+	std::shared_ptr<WavetableSet> set(new WavetableSet(p_samplerate));
+
+	if (p_samplerate == WAVETABLE_CONST_DATA_SAMPLERATE) {
+		// the compiled in tables are already band limited for this rate
+		for (int index_wavetable = 0; index_wavetable < NUMBER_OF_WAVETABLES; ++index_wavetable) {
+			for (int index_subtable = 0; index_subtable < SUBTABLES_PER_WAVETABLE; ++index_subtable) {
+				set->m_pointers[index_wavetable][index_subtable] = getOneSubTable(index_wavetable, index_subtable);
+			}
+		}
+	} else {
+		set->m_data.malloc(WAVETABLE_SET_SIZE);
+		for (int index_wavetable = 0; index_wavetable < NUMBER_OF_WAVETABLES; ++index_wavetable) {
+			for (int index_subtable = 0; index_subtable < SUBTABLES_PER_WAVETABLE; ++index_subtable) {
+				set->m_pointers[index_wavetable][index_subtable] =
+				    set->m_data.get() + (index_wavetable * SUBTABLES_PER_WAVETABLE + index_subtable) * WAVETABLE_LENGTH;
+			}
+		}
+		createWavetables(*set);
+	}
+
+	weak_set = set;
+	return set;
+}
+
+void WavetableStore::createWavetables(WavetableSet &p_set) {
+	const float samplerate   = p_set.getSampleRate();
+	const uint64 source_hash = hashWavetableSource();
+	File cache_file(WAVETABLE_CACHE_PATH + File::getSeparatorString() + "wavetables_" + String((int)samplerate) +
+	                ".bin");
+
+	if (readWavetableCache(cache_file, p_set, source_hash)) {
+		DBG("Loaded wavetables for " + String((int)samplerate) + " Hz from " + cache_file.getFullPathName());
+		return;
+	}
+
+	std::clock_t begin = std::clock();
+
+	dsp::FFT fft(WAVETABLE_FFT_ORDER);
+	float spectrum[2 * WAVETABLE_LENGTH];
+	for (int index_wavetable = 0; index_wavetable < NUMBER_OF_WAVETABLES; ++index_wavetable) {
+
+		// take the spectrum from the full band subtable
+		memset(spectrum, 0, sizeof(spectrum));
+		memcpy(spectrum, getOneSubTable(index_wavetable, 0), WAVETABLE_LENGTH * sizeof(float));
+		fft.performRealOnlyForwardTransform(spectrum, true);
+
+		// bin k = N/2 * (cos_k - i * sin_k)
+		float coefficients[SIN_AND_COS][NUMBER_OF_HARMONICS] = {{0.f}};
+		for (int harmonic = 1; harmonic < NUMBER_OF_HARMONICS; ++harmonic) {
+			coefficients[0][harmonic] = -spectrum[2 * harmonic + 1] * 2.f / WAVETABLE_LENGTH;
+			coefficients[1][harmonic] = spectrum[2 * harmonic] * 2.f / WAVETABLE_LENGTH;
+		}
+
+		WavetableContainer::buildBandLimitedTable(fft,
+		                                          coefficients,
+		                                          NUMBER_OF_HARMONICS,
+		                                          samplerate,
+		                                          p_set.m_data.get() + index_wavetable * SUBTABLES_PER_WAVETABLE *
+		                                                             WAVETABLE_LENGTH);
+	}
+
+	double elapsed_secs = double(std::clock() - begin) / CLOCKS_PER_SEC;
+	DBG("Wavetable creation for " + String((int)samplerate) + " Hz took " + String(elapsed_secs) + " seconds");
+
+	writeWavetableCache(cache_file, p_set, source_hash);
+}
+
+// the cache is only valid for the compiled in tables it was made from
+uint64 WavetableStore::hashWavetableSource() {
+	// FNV-1a
+	uint64 hash = 14695981039346656037ull;
+	for (int index_wavetable = 0; index_wavetable < NUMBER_OF_WAVETABLES; ++index_wavetable) {
+		auto bytes = reinterpret_cast<const uint8 *>(getOneSubTable(index_wavetable, 0));
+		for (size_t byte = 0; byte < WAVETABLE_LENGTH * sizeof(float); ++byte) {
+			hash = (hash ^ bytes[byte]) * 1099511628211ull;
+		}
+	}
+	return hash;
+}
+
+bool WavetableStore::readWavetableCache(const File &p_file, WavetableSet &p_set, uint64 p_source_hash) {
+	FileInputStream input(p_file);
+	if (!input.openedOk()) {
+		return false;
+	}
+
+	const size_t data_size = WAVETABLE_SET_SIZE * sizeof(float);
+	if (input.readInt() != WAVETABLE_CACHE_VERSION || input.readInt() != (int)p_set.getSampleRate() ||
+	    input.readInt() != NUMBER_OF_WAVETABLES || input.readInt() != SUBTABLES_PER_WAVETABLE ||
+	    input.readInt() != WAVETABLE_LENGTH || (uint64)input.readInt64() != p_source_hash ||
+	    input.getNumBytesRemaining() != (int64)data_size) {
+		DBG("Wavetable cache " + p_file.getFullPathName() + " is outdated");
+		return false;
+	}
+
+	// the set isn't handed out before this returns, a failed read is simply overwritten by createWavetables()
+	return input.read(p_set.m_data.get(), (int)data_size) == (int)data_size;
+}
+
+void WavetableStore::writeWavetableCache(const File &p_file, const WavetableSet &p_set, uint64 p_source_hash) {
+	if (!p_file.getParentDirectory().createDirectory().wasOk()) {
+		DBG("Couldn't create wavetable cache directory " + p_file.getParentDirectory().getFullPathName());
+		return;
+	}
+
+	// write to a temporary file first, so other processes never read a half written cache
+	TemporaryFile temp_file(p_file);
+	{
+		FileOutputStream output(temp_file.getFile());
+		if (!output.openedOk()) {
+			return;
+		}
+		output.writeInt(WAVETABLE_CACHE_VERSION);
+		output.writeInt((int)p_set.getSampleRate());
+		output.writeInt(NUMBER_OF_WAVETABLES);
+		output.writeInt(SUBTABLES_PER_WAVETABLE);
+		output.writeInt(WAVETABLE_LENGTH);
+		output.writeInt64((int64)p_source_hash);
+		output.write(p_set.m_data.get(), WAVETABLE_SET_SIZE * sizeof(float));
+		output.flush();
+		if (output.getStatus().failed()) {
+			return;
+		}
+	}
+	if (!temp_file.overwriteTargetFileWithTemporary()) {
+		DBG("Couldn't write wavetable cache " + p_file.getFullPathName());
+	}
+}
@@ -0,0 +1,60 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#pragma once
+
+#include "../../GlobalIncludes.h"
+#include "../OdinConstants.h"
+#include <map>
+#include <memory>
+
+// The factory 1D wavetables, band limited for one samplerate. A set never changes after it was created.
+class WavetableSet {
+public:
+	// SUBTABLES_PER_WAVETABLE pointers, one per subtable
+	const float *const *getSubtables(int p_wavetable) const {
+		return m_pointers[p_wavetable];
+	}
+
+	float getSampleRate() const {
+		return m_samplerate;
+	}
+
+private:
+	friend class WavetableStore;
+	WavetableSet(float p_samplerate) : m_samplerate(p_samplerate) {
+	}
+
+	const float m_samplerate;
+	HeapBlock<float> m_data; // stays empty if the set points to the compiled in tables
+	const float *m_pointers[NUMBER_OF_WAVETABLES][SUBTABLES_PER_WAVETABLE];
+};
+
+// Hands out the factory wavetables to all plugin instances in the process. A set is created (or loaded from the
+// disk cache) when the first instance asks for its samplerate and freed when the last instance lets go of it.
+// Draw tables are not part of this, they are different for each instance.
+class WavetableStore {
+public:
+	static std::shared_ptr<const WavetableSet> getWavetables(float p_samplerate);
+
+private:
+	static void createWavetables(WavetableSet &p_set);
+	static uint64 hashWavetableSource();
+	static bool readWavetableCache(const File &p_file, WavetableSet &p_set, uint64 p_source_hash);
+	static void writeWavetableCache(const File &p_file, const WavetableSet &p_set, uint64 p_source_hash);
+
+	static CriticalSection &getLock();
+	static std::map<int, std::weak_ptr<const WavetableSet>> &getSets();
+};
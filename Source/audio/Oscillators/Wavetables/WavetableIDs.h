@@ -0,0 +1,519 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+// generated by generate-wavetable-ids.py, don't edit by hand
+
+#pragma once
+
+namespace WavetableID {
+enum : int {
+	Sine = 0,
+	ChiptuneTriangle = 1,
+	ChiptuneSquare50 = 2,
+	ChiptuneSquare25 = 3,
+	ChiptuneSquare12_5 = 4,
+	Saw = 5,
+	Triangle = 6,
+	FatSaw = 7,
+	Additive1 = 8,
+	Additive2 = 9,
+	Additive3 = 10,
+	Additive4 = 11,
+	Additive5 = 12,
+	Additive6 = 13,
+	Additive7 = 14,
+	Additive8 = 15,
+	Additive9 = 16,
+	Additive10 = 17,
+	Additive11 = 18,
+	Additive12 = 19,
+	Additive13 = 20,
+	Additive14 = 21,
+	Additive15 = 22,
+	Additive16 = 23,
+	Harmonics1 = 24,
+	Harmonics2 = 25,
+	Harmonics3 = 26,
+	Harmonics4 = 27,
+	Harmonics5 = 28,
+	Harmonics6 = 29,
+	Harmonics7 = 30,
+	Harmonics8 = 31,
+	Harmonics9 = 32,
+	Harmonics10 = 33,
+	Harmonics11 = 34,
+	Harmonics12 = 35,
+	Harmonics13 = 36,
+	Harmonics14 = 37,
+	Harmonics15 = 38,
+	Harmonics16 = 39,
+	Organ1 = 40,
+	Organ2 = 41,
+	Organ3 = 42,
+	Organ4 = 43,
+	BrokenSine1 = 44,
+	BrokenSine2 = 45,
+	BrokenSine3 = 46,
+	BrokenSine4 = 47,
+	Skyline1 = 48,
+	Skyline2 = 49,
+	Skyline3 = 50,
+	Skyline4 = 51,
+	Rectangular1 = 56,
+	Rectangular2 = 57,
+	Rectangular3 = 58,
+	Rectangular4 = 59,
+	Violin1 = 60,
+	Violin2 = 61,
+	Cello1 = 62,
+	Cello2 = 63,
+	Piano1 = 64,
+	Piano2 = 65,
+	Piano3 = 66,
+	Piano4 = 67,
+	Oboe1 = 68,
+	Oboe2 = 69,
+	Oboe3 = 70,
+	Oboe4 = 71,
+	LegToyBox = 72,
+	LegRip2 = 73,
+	LegMale = 74,
+	LegBarbedWire = 75,
+	Trumpet1 = 76,
+	Trumpet2 = 77,
+	Trumpet3 = 78,
+	Trumpet4 = 79,
+	CTHigh = 81,
+	CTHigh2 = 82,
+	CTRich = 84,
+	ChipSaw = 85,
+	ChipSine = 86,
+	CTSoftTune = 87,
+	Glass = 88,
+	GlassMutated1 = 89,
+	GlassMutated2 = 90,
+	GlassMutated3 = 91,
+	FatSawMutated1 = 92,
+	FatSawMutated2 = 93,
+	FatSawMutated3 = 94,
+	FatSawMutated4 = 95,
+	FatSawMutated5 = 96,
+	FatSawMutated6 = 97,
+	FatSawMutated7 = 98,
+	FatSawMutated8 = 99,
+	ChiptuneSquare50Mutated1 = 100,
+	ChiptuneSquare50Mutated2 = 101,
+	ChiptuneSquare50Mutated3 = 102,
+	ChiptuneSquare50Mutated4 = 103,
+	ChiptuneSquare50Mutated5 = 104,
+	ChiptuneSquare50Mutated6 = 105,
+	ChiptuneSquare50Mutated7 = 106,
+	ChiptuneSquare50Mutated8 = 107,
+	LegAdd8 = 108,
+	LegSharp = 109,
+	LegPiano = 110,
+	LegAdd1 = 111,
+	LegCello = 112,
+	LegAah = 113,
+	LegHarm2 = 114,
+	LegNoBass = 115,
+	LegBags = 116,
+	LegOrgan = 117,
+	LegTriQuad = 118,
+	LegAdd3 = 119,
+	AKWF_hvoice_0002 = 120,
+	AKWF_hvoice_0010 = 121,
+	AKWF_hvoice_0014 = 122,
+	AKWF_hvoice_0019 = 123,
+	AKWF_hvoice_0020 = 124,
+	AKWF_hvoice_0021 = 125,
+	AKWF_hvoice_0029 = 126,
+	AKWF_hvoice_0032 = 127,
+	AKWF_hvoice_0037 = 128,
+	AKWF_hvoice_0041 = 129,
+	AKWF_hvoice_0047 = 130,
+	AKWF_hvoice_0049 = 131,
+	AKWF_hvoice_0056 = 132,
+	AKWF_hvoice_0064 = 133,
+	AKWF_hvoice_0071 = 134,
+	AKWF_hvoice_0093 = 135,
+	AKWF_fmsynth_0011 = 136,
+	AKWF_fmsynth_0032 = 137,
+	AKWF_fmsynth_0034 = 138,
+	AKWF_fmsynth_0081 = 139,
+	AKWF_birds_0010 = 140,
+	AKWF_birds_0011 = 141,
+	AKWF_birds_0014 = 142,
+	AKWF_birds_0004 = 143,
+	AKWF_bitreduced_0002 = 144,
+	AKWF_bitreduced_0003 = 145,
+	AKWF_bitreduced_0006 = 146,
+	AKWF_bitreduced_0011 = 147,
+	PerlinReplace1 = 148,
+	PerlinReplace2 = 149,
+	PerlinReplace3 = 150,
+	PerlinReplace4 = 151,
+	BagPipe = 152,
+	BagPipeMutated1 = 153,
+	BagPipeMutated5 = 154,
+	BagPipeMutated4 = 155,
+};
+}
+
+// name of each table, empty for unused indices
+constexpr const char *WAVETABLE_NAMES_1D[NUMBER_OF_WAVETABLES] = {
+	"Sine",
+	"ChiptuneTriangle",
+	"ChiptuneSquare50",
+	"ChiptuneSquare25",
+	"ChiptuneSquare12_5",
+	"Saw",
+	"Triangle",
+	"FatSaw",
+	"Additive1",
+	"Additive2",
+	"Additive3",
+	"Additive4",
+	"Additive5",
+	"Additive6",
+	"Additive7",
+	"Additive8",
+	"Additive9",
+	"Additive10",
+	"Additive11",
+	"Additive12",
+	"Additive13",
+	"Additive14",
+	"Additive15",
+	"Additive16",
+	"Harmonics1",
+	"Harmonics2",
+	"Harmonics3",
+	"Harmonics4",
+	"Harmonics5",
+	"Harmonics6",
+	"Harmonics7",
+	"Harmonics8",
+	"Harmonics9",
+	"Harmonics10",
+	"Harmonics11",
+	"Harmonics12",
+	"Harmonics13",
+	"Harmonics14",
+	"Harmonics15",
+	"Harmonics16",
+	"Organ1",
+	"Organ2",
+	"Organ3",
+	"Organ4",
+	"BrokenSine1",
+	"BrokenSine2",
+	"BrokenSine3",
+	"BrokenSine4",
+	"Skyline1",
+	"Skyline2",
+	"Skyline3",
+	"Skyline4",
+	"",
+	"",
+	"",
+	"",
+	"Rectangular1",
+	"Rectangular2",
+	"Rectangular3",
+	"Rectangular4",
+	"Violin1",
+	"Violin2",
+	"Cello1",
+	"Cello2",
+	"Piano1",
+	"Piano2",
+	"Piano3",
+	"Piano4",
+	"Oboe1",
+	"Oboe2",
+	"Oboe3",
+	"Oboe4",
+	"LegToyBox",
+	"LegRip2",
+	"LegMale",
+	"LegBarbedWire",
+	"Trumpet1",
+	"Trumpet2",
+	"Trumpet3",
+	"Trumpet4",
+	"",
+	"CTHigh",
+	"CTHigh2",
+	"",
+	"CTRich",
+	"ChipSaw",
+	"ChipSine",
+	"CTSoftTune",
+	"Glass",
+	"GlassMutated1",
+	"GlassMutated2",
+	"GlassMutated3",
+	"FatSawMutated1",
+	"FatSawMutated2",
+	"FatSawMutated3",
+	"FatSawMutated4",
+	"FatSawMutated5",
+	"FatSawMutated6",
+	"FatSawMutated7",
+	"FatSawMutated8",
+	"ChiptuneSquare50Mutated1",
+	"ChiptuneSquare50Mutated2",
+	"ChiptuneSquare50Mutated3",
+	"ChiptuneSquare50Mutated4",
+	"ChiptuneSquare50Mutated5",
+	"ChiptuneSquare50Mutated6",
+	"ChiptuneSquare50Mutated7",
+	"ChiptuneSquare50Mutated8",
+	"LegAdd8",
+	"LegSharp",
+	"LegPiano",
+	"LegAdd1",
+	"LegCello",
+	"LegAah",
+	"LegHarm2",
+	"LegNoBass",
+	"LegBags",
+	"LegOrgan",
+	"LegTriQuad",
+	"LegAdd3",
+	"AKWF_hvoice_0002",
+	"AKWF_hvoice_0010",
+	"AKWF_hvoice_0014",
+	"AKWF_hvoice_0019",
+	"AKWF_hvoice_0020",
+	"AKWF_hvoice_0021",
+	"AKWF_hvoice_0029",
+	"AKWF_hvoice_0032",
+	"AKWF_hvoice_0037",
+	"AKWF_hvoice_0041",
+	"AKWF_hvoice_0047",
+	"AKWF_hvoice_0049",
+	"AKWF_hvoice_0056",
+	"AKWF_hvoice_0064",
+	"AKWF_hvoice_0071",
+	"AKWF_hvoice_0093",
+	"AKWF_fmsynth_0011",
+	"AKWF_fmsynth_0032",
+	"AKWF_fmsynth_0034",
+	"AKWF_fmsynth_0081",
+	"AKWF_birds_0010",
+	"AKWF_birds_0011",
+	"AKWF_birds_0014",
+	"AKWF_birds_0004",
+	"AKWF_bitreduced_0002",
+	"AKWF_bitreduced_0003",
+	"AKWF_bitreduced_0006",
+	"AKWF_bitreduced_0011",
+	"PerlinReplace1",
+	"PerlinReplace2",
+	"PerlinReplace3",
+	"PerlinReplace4",
+	"BagPipe",
+	"BagPipeMutated1",
+	"BagPipeMutated5",
+	"BagPipeMutated4",
+	"",
+	"",
+	"",
+	"",
+};
+
+namespace LFOTableID {
+enum : int {
+	Pyramid4 = 0,
+	Pyramid6 = 1,
+	Pyramid8 = 2,
+	Pyramid12 = 3,
+	Stair3 = 4,
+	Stair4 = 5,
+	Stair6 = 6,
+	Stair8 = 7,
+	Stair12 = 8,
+	Square50 = 9,
+	Square25 = 10,
+	Square12 = 11,
+	Spike = 12,
+};
+}
+
+// name of each table, empty for unused indices
+constexpr const char *LFO_TABLE_NAMES[NUMBER_OF_WAVETABLES] = {
+	"Pyramid4",
+	"Pyramid6",
+	"Pyramid8",
+	"Pyramid12",
+	"Stair3",
+	"Stair4",
+	"Stair6",
+	"Stair8",
+	"Stair12",
+	"Square50",
+	"Square25",
+	"Square12",
+	"Spike",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+	"",
+};
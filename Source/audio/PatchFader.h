@@ -0,0 +1,104 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#pragma once
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include <atomic>
+
+#define PATCH_FADE_MILLISECONDS 10.f         // default length of the fade out before and the fade in after a patch change
+#define PATCH_FADE_MAX_WAIT_MILLISECONDS 200 // how long a patch waits for the fade out at most
+
+// Hides patch changes while audio is running. The message thread starts the fade out, hands the patch over once the
+// audio thread reports silence and fades back in. It never waits for the audio thread itself, but polls from a
+// timer. Held notes keep playing through the switch:
+//
+//   if (!fader.fadeOut()) { handOver(); fader.fadeIn(); }
+//   ...
+//   timerCallback(): if (fader.isSilent()) { handOver(); fader.fadeIn(); }
+//
+// The audio thread calls process() at the end of every block.
+class PatchFader {
+public:
+	void setSampleRate(float p_samplerate) {
+		m_samplerate = p_samplerate;
+	}
+
+	// 0 switches without a fade
+	void setFadeTime(float p_milliseconds) {
+		m_fade_milliseconds = jmax(0.f, p_milliseconds);
+	}
+
+	// message thread. Starts the fade out and returns right away, false if there is no fade since no audio is
+	// running. Hosts which set the state from another thread might do so between blocks, those don't get a fade
+	bool fadeOut() {
+		const uint32 since_last_block = Time::getMillisecondCounter() - m_last_block_time.load();
+		if (m_fade_milliseconds <= 0.f || since_last_block > PATCH_FADE_MAX_WAIT_MILLISECONDS ||
+		    !MessageManager::existsAndIsCurrentThread()) {
+			return false;
+		}
+		m_state = FadingOut;
+		return true;
+	}
+
+	// the audio thread finished the fade out
+	bool isSilent() const {
+		return m_state == Silent;
+	}
+
+	// message thread, fades in from wherever the fade out got to
+	void fadeIn() {
+		int state = m_state;
+		while (state != Idle && !m_state.compare_exchange_weak(state, FadingIn)) {
+		}
+	}
+
+	// audio thread, applies the fade to the output in place
+	void process(float *p_left, float *p_right, int p_num_samples) {
+		m_last_block_time = Time::getMillisecondCounter();
+
+		int state = m_state;
+		if (state == Idle) {
+			return;
+		}
+		const float step = 1000.f / (jmax(1.f, m_fade_milliseconds.load()) * m_samplerate);
+		for (int sample = 0; sample < p_num_samples; ++sample) {
+			if (state == FadingOut) {
+				m_gain = jmax(0.f, m_gain - step);
+			} else if (state == FadingIn) {
+				m_gain = jmin(1.f, m_gain + step);
+			}
+			p_left[sample] *= m_gain;
+			p_right[sample] *= m_gain;
+		}
+
+		// the message thread might have moved on already, so the state only advances if it didn't
+		if (state == FadingOut && m_gain <= 0.f) {
+			m_state.compare_exchange_strong(state, Silent);
+		} else if (state == FadingIn && m_gain >= 1.f) {
+			m_state.compare_exchange_strong(state, Idle);
+		}
+	}
+
+private:
+	enum State { Idle, FadingOut, Silent, FadingIn };
+
+	std::atomic<int> m_state{Idle};
+	std::atomic<uint32> m_last_block_time{0};
+
+	float m_gain       = 1.f; // only used by the audio thread
+	float m_samplerate = 44100.f;
+	std::atomic<float> m_fade_milliseconds{PATCH_FADE_MILLISECONDS};
+};
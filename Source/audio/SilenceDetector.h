@@ -0,0 +1,81 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+#define SILENCE_THRESHOLD 0.00001f // -100 dBFS
+#define SILENCE_HOLD_SECONDS 0.1f  // how long a stage has to stay silent before it goes to sleep
+
+// Lets a stage skip processing while it has nothing to do. A stage falls asleep once its input was silent and its
+// output stayed silent for its hold time, which has to cover the longest delay inside the stage. It wakes up as
+// soon as its input isn't silent anymore. Usage per block:
+//
+//   if (detector.isAwake(left, right, n)) {
+//     process(left, right, n);
+//     detector.checkOutput(left, right, n, hold_seconds);
+//   }
+//
+// A sleeping stage is bypassed, its input is below the threshold anyway.
+class SilenceDetector {
+public:
+	void setSampleRate(float p_samplerate) {
+		m_samplerate = p_samplerate;
+	}
+
+	// a reset stage has no tail
+	void reset() {
+		m_sleeping       = true;
+		m_input_silent   = true;
+		m_silent_samples = 0;
+	}
+
+	bool isAwake(const float *p_left, const float *p_right, int p_num_samples) {
+		m_input_silent = isSilent(p_left, p_right, p_num_samples);
+		if (!m_input_silent) {
+			m_sleeping = false;
+		}
+		return !m_sleeping;
+	}
+
+	void checkOutput(const float *p_left, const float *p_right, int p_num_samples, float p_hold_seconds) {
+		if (m_input_silent && isSilent(p_left, p_right, p_num_samples)) {
+			m_silent_samples += p_num_samples;
+			m_sleeping = m_silent_samples >= (int)(p_hold_seconds * m_samplerate);
+		} else {
+			m_silent_samples = 0;
+		}
+	}
+
+	bool isSleeping() const {
+		return m_sleeping;
+	}
+
+	static bool isSilent(const float *p_left, const float *p_right, int p_num_samples) {
+		float peak = 0.f;
+		for (int sample = 0; sample < p_num_samples; ++sample) {
+			peak = std::max(peak, std::max(std::fabs(p_left[sample]), std::fabs(p_right[sample])));
+		}
+		return peak < SILENCE_THRESHOLD;
+	}
+
+private:
+	float m_samplerate   = 44100.f;
+	bool m_sleeping      = true; // the buffers start out empty
+	bool m_input_silent  = true;
+	int m_silent_samples = 0;
+};
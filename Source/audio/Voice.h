@@ -15,7 +15,7 @@
 
 #pragma once
 
-#include "include/Tunings.h"
+#include "NoteFrequencyTable.h"
 #include "../GlobalIncludes.h"
 #include "Amplifier.h"
 #include "FX/OversamplingDistortion.h"
@@ -119,6 +119,21 @@ struct Voice {
 		vector_osc[2].setSyncOscillator(p_osc);
 	}
 
+	// oversampling of the distortion and of synced oscs, clears their state
+	void setOversampling(int p_factor, Oversampler::Quality p_quality) {
+		distortion[0].setOversampling(p_factor, p_quality);
+		distortion[1].setOversampling(p_factor, p_quality);
+		for (int osc = 1; osc < 3; ++osc) {
+			analog_osc[osc].setSyncOversampling(p_factor, p_quality);
+			wavetable_osc[osc].setSyncOversampling(p_factor, p_quality);
+			wavedraw_osc[osc].setSyncOversampling(p_factor, p_quality);
+			specdraw_osc[osc].setSyncOversampling(p_factor, p_quality);
+			chipdraw_osc[osc].setSyncOversampling(p_factor, p_quality);
+			chiptune_osc[osc].setSyncOversampling(p_factor, p_quality);
+			vector_osc[osc].setSyncOversampling(p_factor, p_quality);
+		}
+	}
+
 	void setMonoPolyLegato(PlayModes p_mode) {
 		m_mono_poly_legato = p_mode;
 	}
@@ -128,7 +143,7 @@ struct Voice {
 	}
 
 	float MIDINoteToFreq(int p_MIDI_note) {
-		return m_tuning_ptr->frequencyForMidiNote(p_MIDI_note);
+		return m_note_frequencies->getFrequency(p_MIDI_note);
 		//return 27.5f * pow(2.f, (float)(p_MIDI_note - 21) / 12.f);
 	}
 
@@ -422,17 +437,17 @@ struct Voice {
 	}
 
 	void setFilterMIDIValues(int p_MIDI_note, int p_MIDI_vel) {
-		// shift note here so the lowest note possible is 21
-		p_MIDI_note -= 21;
-		p_MIDI_note = p_MIDI_note < 0 ? 0 : p_MIDI_note;
+		// key tracking follows the tuned note, shift it here so the lowest note possible is 21
+		float tuned_note = m_note_frequencies->getTunedNote(p_MIDI_note) - 21.f;
+		tuned_note       = tuned_note < 0 ? 0 : tuned_note;
 
 		for (int fil = 0; fil < 2; ++fil) {
-			ladder_filter[fil].m_MIDI_note = p_MIDI_note;
-			diode_filter[fil].m_MIDI_note  = p_MIDI_note;
-			korg_filter[fil].m_MIDI_note   = p_MIDI_note;
-			SEM_filter_12[fil].m_MIDI_note = p_MIDI_note;
-			comb_filter[fil].m_MIDI_note   = p_MIDI_note;
-			ring_mod[fil].m_MIDI_note      = p_MIDI_note;
+			ladder_filter[fil].m_MIDI_note = tuned_note;
+			diode_filter[fil].m_MIDI_note  = tuned_note;
+			korg_filter[fil].m_MIDI_note   = tuned_note;
+			SEM_filter_12[fil].m_MIDI_note = tuned_note;
+			comb_filter[fil].m_MIDI_note   = tuned_note;
+			ring_mod[fil].m_MIDI_note      = tuned_note;
 
 			ladder_filter[fil].m_MIDI_velocity = p_MIDI_vel;
 			diode_filter[fil].m_MIDI_velocity  = p_MIDI_vel;
@@ -574,8 +589,8 @@ struct Voice {
 		unison_detune_factor = pow(2.f, unison_detune_position * unison_detune_amount / 12.f);
 	}
 
-	void setTuningPtr(Tunings::Tuning* p_tuning_ptr){
-		m_tuning_ptr = p_tuning_ptr;
+	void setNoteFrequencyTable(const NoteFrequencyTable* p_note_frequencies){
+		m_note_frequencies = p_note_frequencies;
 	}
 
 	// oscs
@@ -612,7 +627,7 @@ struct Voice {
 	float unison_pan_position    = 0; // [-1,1]
 	float unison_detune_position = 0; //[-1,1]
 
-	Tunings::Tuning* m_tuning_ptr;
+	const NoteFrequencyTable* m_note_frequencies;
 	float unison_detune_factor = 1.f; //calculated from unison_detune_position
 
 	float unison_detune_amount  = 0.08f;
@@ -732,6 +747,43 @@ public:
 		DBG("Voice manager freed voice " + std::to_string(p_voice));
 	}
 
+	// adds a started voice to the list of sounding voices, returns false if it was already in there
+	bool addActiveVoice(int p_voice) {
+		if (m_voice_in_active_list[p_voice]) {
+			return false;
+		}
+		m_voice_in_active_list[p_voice]              = true;
+		m_active_voices[m_number_of_active_voices++] = p_voice;
+		return true;
+	}
+
+	// voices end from within their amp envelope, so this is polled by the processor.
+	// keeps the order of the remaining voices
+	void removeInactiveVoices() {
+		int write_index = 0;
+		for (int index = 0; index < m_number_of_active_voices; ++index) {
+			int voice = m_active_voices[index];
+			if (*m_actual_voice_pointers[voice]) {
+				m_active_voices[write_index++] = voice;
+			} else {
+				m_voice_in_active_list[voice] = false;
+			}
+		}
+		m_number_of_active_voices = write_index;
+	}
+
+	const int *getActiveVoices() const {
+		return m_active_voices;
+	}
+
+	const int *getNumberOfActiveVoicesPointer() const {
+		return &m_number_of_active_voices;
+	}
+
+	int getNumberOfActiveVoices() const {
+		return m_number_of_active_voices;
+	}
+
 	void setSustainActive(bool p_active) {
 		m_sustain_active       = p_active;
 		m_sustain_active_float = p_active ? 1.f : 0.f;
@@ -802,9 +854,12 @@ public:
 			m_voice_history[voice] = voice;
 			voice_busy[voice]      = false;
 			m_kill_list[voice]     = false;
+
+			m_voice_in_active_list[voice] = false;
 		}
-		m_sustain_active       = false;
-		m_sustain_active_float = 0.f;
+		m_number_of_active_voices = 0;
+		m_sustain_active          = false;
+		m_sustain_active_float    = 0.f;
 	}
 
 	bool voice_busy[VOICES] = {0}; // is voice busy
@@ -822,4 +877,9 @@ protected:
 
 	bool m_kill_list[VOICES] = {0};
 	int m_kill_list_note[VOICES];
+
+	// compact list of the sounding voices, so the audio loop scales with the number of notes
+	int m_active_voices[VOICES]         = {0};
+	int m_number_of_active_voices       = 0;
+	bool m_voice_in_active_list[VOICES] = {0};
 };
\ No newline at end of file
@@ -0,0 +1,114 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#include "VoiceWorkerPool.h"
+#include <thread>
+
+VoiceWorkerPool::~VoiceWorkerPool() {
+	setNumberOfWorkers(0);
+}
+
+void VoiceWorkerPool::setNumberOfWorkers(int p_workers) {
+	p_workers = jlimit(0, VOICE_WORKERS_MAX, p_workers);
+	if (p_workers == m_workers.size()) {
+		return;
+	}
+
+	for (auto *worker : m_workers) {
+		worker->signalThreadShouldExit();
+		worker->notify();
+	}
+	for (auto *worker : m_workers) {
+		worker->stopThread(1000);
+	}
+	m_workers.clear();
+
+	for (int index = 0; index < p_workers; ++index) {
+		auto *worker = m_workers.add(new Worker(*this, index));
+		// the audio thread waits for the workers, so they need the same priority
+#if JUCE_MAJOR_VERSION >= 7
+		worker->startRealtimeThread(Thread::RealtimeOptions());
+#else
+		worker->startThread(Thread::realtimeAudioPriority);
+#endif
+	}
+	DBG("Rendering voices on " + String(p_workers) + " additional threads");
+}
+
+void VoiceWorkerPool::run(int p_count, Job p_job, void *p_context) {
+	if (m_workers.isEmpty() || p_count < 2) {
+		for (int index = 0; index < p_count; ++index) {
+			p_job(p_context, index);
+		}
+		return;
+	}
+
+	// a claim only succeeds while the batch it belongs to is published, so these can't be read too early
+	m_job       = p_job;
+	m_context   = p_context;
+	m_jobs_done = 0;
+	m_work      = ((uint64)(++m_generation) << 32) | ((uint64)p_count << 16);
+
+	for (auto *worker : m_workers) {
+		if (worker->m_sleeping.exchange(false)) {
+			worker->notify();
+		}
+	}
+
+	doJobs();
+
+	// the remaining jobs are already being done by the workers
+	while (m_jobs_done.load() < p_count) {
+	}
+}
+
+void VoiceWorkerPool::doJobs() {
+	uint64 work = m_work.load();
+	while ((work & 0xffff) < ((work >> 16) & 0xffff)) {
+		if (m_work.compare_exchange_weak(work, work + 1)) {
+			m_job.load()(m_context.load(), (int)(work & 0xffff));
+			m_jobs_done.fetch_add(1);
+			work = m_work.load();
+		}
+	}
+}
+
+void VoiceWorkerPool::Worker::run() {
+	ScopedNoDenormals no_denormals;
+
+	uint32 generation = 0;
+	while (!threadShouldExit()) {
+		// batches come in once per sub-block, so spin for a while before going to sleep
+		for (int spin = 0; spin < VOICE_WORKER_SPIN_COUNT; ++spin) {
+			if (getGeneration(m_pool.m_work.load()) != generation || threadShouldExit()) {
+				break;
+			}
+			std::this_thread::yield();
+		}
+
+		if (getGeneration(m_pool.m_work.load()) == generation) {
+			m_sleeping = true;
+			// a batch published after this check will see m_sleeping and wake us up
+			if (getGeneration(m_pool.m_work.load()) == generation && !threadShouldExit()) {
+				wait(-1);
+			}
+			m_sleeping = false;
+			continue;
+		}
+
+		generation = getGeneration(m_pool.m_work.load());
+		m_pool.doJobs();
+	}
+}
@@ -0,0 +1,72 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#pragma once
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include <atomic>
+
+#define VOICE_WORKERS_MAX 7
+#define VOICE_WORKER_SPIN_COUNT 2000 // polls before a worker goes to sleep
+
+// splits per voice work between the audio thread and a few helper threads. Jobs are claimed one by one
+// from a single atomic counter, so whichever thread is free takes the next voice. run() doesn't lock or
+// allocate, workers spin for a while after each batch and only sleep if no new batch comes in.
+class VoiceWorkerPool {
+public:
+	typedef void (*Job)(void *p_context, int p_index);
+
+	~VoiceWorkerPool();
+
+	// starts or stops helper threads, 0 renders everything on the calling thread.
+	// not realtime safe, only call this while run() isn't running
+	void setNumberOfWorkers(int p_workers);
+	int getNumberOfWorkers() const {
+		return m_workers.size();
+	}
+
+	// calls p_job(p_context, index) for every index in [0, p_count), returns when all of them are done
+	void run(int p_count, Job p_job, void *p_context);
+
+private:
+	class Worker : public Thread {
+	public:
+		Worker(VoiceWorkerPool &p_pool, int p_index) :
+		    Thread("Odin Voice Worker " + String(p_index)), m_pool(p_pool) {
+		}
+		void run() override;
+
+		std::atomic<bool> m_sleeping{false};
+
+	private:
+		VoiceWorkerPool &m_pool;
+	};
+
+	static uint32 getGeneration(uint64 p_work) {
+		return (uint32)(p_work >> 32);
+	}
+
+	// claims and does jobs of the current batch until none are left
+	void doJobs();
+
+	OwnedArray<Worker> m_workers;
+
+	// batch number << 32 | number of jobs << 16 | next job index
+	std::atomic<uint64> m_work{0};
+	std::atomic<int> m_jobs_done{0};
+	std::atomic<Job> m_job{nullptr};
+	std::atomic<void *> m_context{nullptr};
+	uint32 m_generation = 0;
+};
@@ -0,0 +1,362 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+// Headless offline renderer: loads .odin patches into a fresh OdinAudioProcessor each, plays a fixed MIDI
+// sequence and measures how long every processBlock() takes. Optionally writes the rendered audio as WAV.
+//
+// usage: Odin2Benchmark [--patches <.odin file or directory>] [--samplerate 48000] [--block 256]
+//                       [--seconds 8] [--threads 0] [--control-rate 32] [--wav <directory>] [--csv <file>]
+//                       [--profile <file>] [--instances <n>]
+//
+// --profile writes the time spent per module as CSV, which needs a build with -DODIN2_PROFILING=ON
+// --instances only creates n instances of the first patch the way a host loads a session and reports how long that
+// takes, nothing is rendered
+
+#include "../PluginProcessor.h"
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#define BENCHMARK_DEFAULT_PATCHES "Soundbanks/Factory Presets"
+#define BENCHMARK_DEFAULT_SAMPLERATE 48000
+#define BENCHMARK_DEFAULT_BLOCK_SIZE 256
+#define BENCHMARK_DEFAULT_SECONDS 8
+
+// one note of the sequence, times in seconds
+struct BenchmarkNote {
+	double start;
+	double length;
+	int note;
+	int velocity;
+};
+
+// chord, fast monophonic run, then a dense chord over a bass note, so polyphony, fast retriggers and
+// release tails are all exercised. Ends after 6.5 seconds, the rest of the render is the release tail
+static const BenchmarkNote BENCHMARK_SEQUENCE[] = {
+    {0.0, 1.5, 48, 100},   {0.0, 1.5, 52, 90},    {0.0, 1.5, 55, 90},    {0.0, 1.5, 59, 80},
+    {2.0, 0.12, 60, 110},  {2.125, 0.12, 63, 70}, {2.25, 0.12, 67, 90},  {2.375, 0.12, 70, 60},
+    {2.5, 0.12, 72, 110},  {2.625, 0.12, 70, 70}, {2.75, 0.12, 67, 90},  {2.875, 0.12, 63, 60},
+    {3.0, 0.12, 60, 110},  {3.125, 0.12, 55, 70}, {3.25, 0.12, 51, 90},  {3.375, 0.12, 48, 60},
+    {4.0, 2.5, 36, 127},   {4.0, 2.5, 60, 80},    {4.0, 2.5, 63, 80},    {4.0, 2.5, 67, 80},
+    {4.0, 2.5, 70, 80},    {4.0, 2.5, 74, 80},    {4.0, 2.5, 77, 80},    {4.0, 2.5, 81, 80},
+};
+
+struct BenchmarkResult {
+	String name;
+	double create_ms;
+	double load_ms;
+	double render_seconds;
+	double audio_seconds;
+	double p50_ms;
+	double p99_ms;
+	double max_ms;
+	// percent of the audio time spent per module
+	double module_percent[ModuleProfiler::NumberOfModules];
+};
+
+static double ticksToMs(int64 p_ticks) {
+	return Time::highResolutionTicksToSeconds(p_ticks) * 1000.;
+}
+
+static double percentile(const std::vector<double> &p_sorted, double p_percentile) {
+	if (p_sorted.empty()) {
+		return 0.;
+	}
+	size_t index = (size_t)(p_percentile * (double)(p_sorted.size() - 1) + 0.5);
+	return p_sorted[std::min(index, p_sorted.size() - 1)];
+}
+
+// collects the MIDI events of the sequence which fall into [p_start_sample, p_start_sample + p_num_samples)
+static void fillMidiBuffer(MidiBuffer &p_midi, int64 p_start_sample, int p_num_samples, double p_samplerate) {
+	p_midi.clear();
+	for (const auto &note : BENCHMARK_SEQUENCE) {
+		const int64 on  = (int64)(note.start * p_samplerate);
+		const int64 off = (int64)((note.start + note.length) * p_samplerate);
+		if (on >= p_start_sample && on < p_start_sample + p_num_samples) {
+			p_midi.addEvent(MidiMessage::noteOn(1, note.note, (uint8)note.velocity), (int)(on - p_start_sample));
+		}
+		if (off >= p_start_sample && off < p_start_sample + p_num_samples) {
+			p_midi.addEvent(MidiMessage::noteOff(1, note.note), (int)(off - p_start_sample));
+		}
+	}
+}
+
+static BenchmarkResult renderPatch(const File &p_patch,
+                                   double p_samplerate,
+                                   int p_block_size,
+                                   double p_seconds,
+                                   int p_threads,
+                                   int p_control_rate,
+                                   int p_oversampling,
+                                   Oversampler::Quality p_oversampling_quality,
+                                   const File &p_wav_dir) {
+	BenchmarkResult result;
+	result.name       = p_patch.getRelativePathFrom(File::getCurrentWorkingDirectory());
+	const int64 start = Time::getHighResolutionTicks();
+
+	OdinAudioProcessor processor;
+	processor.setVoiceThreads(p_threads);
+	processor.setControlRate(p_control_rate);
+	processor.setOversampling(p_oversampling, p_oversampling_quality);
+	processor.setRateAndBufferSizeDetails(p_samplerate, p_block_size);
+	processor.prepareToPlay(p_samplerate, p_block_size);
+	const int64 created = Time::getHighResolutionTicks();
+	result.create_ms    = ticksToMs(created - start);
+
+	FileInputStream patch_stream(p_patch);
+	if (patch_stream.openedOk()) {
+		processor.readPatch(ValueTree::readFromStream(patch_stream));
+	} else {
+		std::fprintf(stderr, "Couldn't open %s, rendering the init patch\n", p_patch.getFullPathName().toRawUTF8());
+	}
+	result.load_ms = ticksToMs(Time::getHighResolutionTicks() - created);
+
+	std::unique_ptr<AudioFormatWriter> writer;
+	if (p_wav_dir != File()) {
+		p_wav_dir.createDirectory();
+		auto wav_stream = p_wav_dir.getChildFile(p_patch.getFileNameWithoutExtension() + ".wav").createOutputStream();
+		if (wav_stream) {
+			wav_stream->setPosition(0);
+			wav_stream->truncate();
+			WavAudioFormat wav_format;
+			writer.reset(wav_format.createWriterFor(wav_stream.get(), p_samplerate, 2, 24, {}, 0));
+			if (writer) {
+				// the writer owns the stream now
+				wav_stream.release();
+			}
+		}
+	}
+
+	AudioBuffer<float> buffer(2, p_block_size);
+	MidiBuffer midi;
+	const int64 total_samples = (int64)(p_seconds * p_samplerate);
+	std::vector<double> block_times;
+	block_times.reserve((size_t)(total_samples / p_block_size + 1));
+
+	const ModuleProfiler::Snapshot profile_start = processor.m_profiler.getSnapshot();
+	int64 render_ticks                           = 0;
+	for (int64 sample = 0; sample < total_samples; sample += p_block_size) {
+		const int num_samples = (int)std::min((int64)p_block_size, total_samples - sample);
+		buffer.setSize(2, num_samples, false, false, true);
+		buffer.clear();
+		fillMidiBuffer(midi, sample, num_samples, p_samplerate);
+
+		const int64 block_start = Time::getHighResolutionTicks();
+		processor.processBlock(buffer, midi);
+		const int64 block_ticks = Time::getHighResolutionTicks() - block_start;
+
+		render_ticks += block_ticks;
+		block_times.push_back(ticksToMs(block_ticks));
+		if (writer) {
+			writer->writeFromAudioSampleBuffer(buffer, 0, num_samples);
+		}
+	}
+	const ModuleProfiler::Snapshot profile_end = processor.m_profiler.getSnapshot();
+	for (int module = 0; module < ModuleProfiler::NumberOfModules; ++module) {
+		result.module_percent[module] = profile_end.getPercent(module, profile_start, p_samplerate);
+	}
+	processor.releaseResources();
+
+	std::sort(block_times.begin(), block_times.end());
+	result.render_seconds = Time::highResolutionTicksToSeconds(render_ticks);
+	result.audio_seconds  = (double)total_samples / p_samplerate;
+	result.p50_ms         = percentile(block_times, 0.5);
+	result.p99_ms         = percentile(block_times, 0.99);
+	result.max_ms         = block_times.empty() ? 0. : block_times.back();
+	return result;
+}
+
+// constructs all instances first, then restores their state, then prepares them, like a host opening a session
+static void measureInstantiation(int p_instances, const File &p_patch, double p_samplerate, int p_block_size) {
+	std::vector<std::unique_ptr<OdinAudioProcessor>> processors;
+	processors.reserve((size_t)p_instances);
+
+	const int64 start = Time::getHighResolutionTicks();
+	for (int instance = 0; instance < p_instances; ++instance) {
+		processors.emplace_back(new OdinAudioProcessor());
+	}
+	const int64 constructed = Time::getHighResolutionTicks();
+
+	MemoryBlock state;
+	FileInputStream patch_stream(p_patch);
+	if (patch_stream.openedOk()) {
+		processors[0]->readPatch(ValueTree::readFromStream(patch_stream));
+	}
+	processors[0]->getStateInformation(state);
+	const int64 state_start = Time::getHighResolutionTicks();
+	for (auto &processor : processors) {
+		processor->setStateInformation(state.getData(), (int)state.getSize());
+	}
+	const int64 restored = Time::getHighResolutionTicks();
+
+	for (auto &processor : processors) {
+		processor->setRateAndBufferSizeDetails(p_samplerate, p_block_size);
+		processor->prepareToPlay(p_samplerate, p_block_size);
+	}
+	const int64 prepared = Time::getHighResolutionTicks();
+
+	processors.clear();
+	const int64 destroyed = Time::getHighResolutionTicks();
+
+	auto print_row = [&](const char *p_name, int64 p_ticks) {
+		std::printf("%-10s %10.1f %12.2f\n", p_name, ticksToMs(p_ticks), ticksToMs(p_ticks) / p_instances);
+	};
+	std::printf("%d instances of %s\n\n", p_instances, p_patch.getFileName().toRawUTF8());
+	std::printf("%-10s %10s %12s\n", "", "total ms", "instance ms");
+	print_row("construct", constructed - start);
+	print_row("set state", restored - state_start);
+	print_row("prepare", prepared - restored);
+	print_row("destroy", destroyed - prepared);
+}
+
+int main(int argc, char *argv[]) {
+	ScopedJuceInitialiser_GUI juce_initialiser;
+	ArgumentList args(argc, argv);
+
+	if (args.containsOption("--help|-h")) {
+		std::printf("usage: %s [--patches <.odin file or directory>] [--samplerate %d] [--block %d] [--seconds %d] "
+		            "[--threads 0] [--control-rate 32] [--oversampling 4] [--oversampling-quality 0] [--wav <directory>] "
+		            "[--csv <file>] [--profile <file>] [--instances <n>]\n",
+		            args.executableName.toRawUTF8(),
+		            BENCHMARK_DEFAULT_SAMPLERATE,
+		            BENCHMARK_DEFAULT_BLOCK_SIZE,
+		            BENCHMARK_DEFAULT_SECONDS);
+		return 0;
+	}
+
+	auto option = [&](const char *p_option, const String &p_default) {
+		return args.containsOption(p_option) ? args.getValueForOption(p_option) : p_default;
+	};
+	const File patches = File::getCurrentWorkingDirectory().getChildFile(option("--patches", BENCHMARK_DEFAULT_PATCHES));
+	const double samplerate = option("--samplerate", String(BENCHMARK_DEFAULT_SAMPLERATE)).getDoubleValue();
+	const int block_size    = option("--block", String(BENCHMARK_DEFAULT_BLOCK_SIZE)).getIntValue();
+	const double seconds    = option("--seconds", String(BENCHMARK_DEFAULT_SECONDS)).getDoubleValue();
+	const int threads       = option("--threads", "0").getIntValue();
+	const int control_rate  = option("--control-rate", String(SUB_BLOCK_SIZE)).getIntValue();
+	const int oversampling  = option("--oversampling", "4").getIntValue();
+	const auto oversampling_quality = (Oversampler::Quality)option("--oversampling-quality", "0").getIntValue();
+	const File wav_dir      = args.containsOption("--wav") ? args.getFileForOption("--wav") : File();
+	const File csv_file     = args.containsOption("--csv") ? args.getFileForOption("--csv") : File();
+	const File profile_file = args.containsOption("--profile") ? args.getFileForOption("--profile") : File();
+	const int instances     = option("--instances", "0").getIntValue();
+
+#ifndef ODIN_PROFILING
+	if (profile_file != File()) {
+		std::fprintf(stderr, "--profile needs a build with -DODIN2_PROFILING=ON\n");
+		return 1;
+	}
+#endif
+
+	if (samplerate <= 0 || block_size <= 0 || seconds <= 0) {
+		std::fprintf(stderr, "samplerate, block size and seconds have to be positive\n");
+		return 1;
+	}
+
+	Array<File> patch_files;
+	if (patches.isDirectory()) {
+		patch_files = patches.findChildFiles(File::findFiles, true, "*.odin");
+		// same order on every system, so runs can be compared line by line
+		patch_files.sort();
+	} else if (patches.existsAsFile()) {
+		patch_files.add(patches);
+	}
+	if (patch_files.isEmpty()) {
+		std::fprintf(stderr, "No patches found at %s\n", patches.getFullPathName().toRawUTF8());
+		return 1;
+	}
+
+	if (instances > 0) {
+		measureInstantiation(instances, patch_files[0], samplerate, block_size);
+		return 0;
+	}
+
+	std::printf("%d patches, %.0f Hz, %d samples per block (%.2f ms), %.1f s each, %d voice threads, "
+	            "control rate %d, %dx oversampling\n\n",
+	            patch_files.size(),
+	            samplerate,
+	            block_size,
+	            1000. * block_size / samplerate,
+	            seconds,
+	            threads,
+	            control_rate,
+	            oversampling);
+	std::printf("%9s %9s %8s %8s %8s %8s %8s  %s\n", "create ms", "load ms", "RT x", "CPU %", "p50 ms", "p99 ms",
+	            "max ms", "patch");
+
+	String csv = "patch,create_ms,load_ms,realtime_factor,cpu_percent,p50_ms,p99_ms,max_ms\n";
+	double total_render = 0.;
+	double total_audio  = 0.;
+	double worst_max    = 0.;
+	String worst_patch;
+
+	String profile_csv = "patch";
+	for (int module = 0; module < ModuleProfiler::NumberOfModules; ++module) {
+		profile_csv << "," << String(ModuleProfiler::getModuleName(module)).replaceCharacters(" &", "__");
+	}
+	profile_csv << "\n";
+
+	for (const auto &patch : patch_files) {
+		const BenchmarkResult result = renderPatch(
+		    patch, samplerate, block_size, seconds, threads, control_rate, oversampling, oversampling_quality, wav_dir);
+
+		const double realtime_factor = result.render_seconds > 0. ? result.audio_seconds / result.render_seconds : 0.;
+		const double cpu_percent     = 100. * result.render_seconds / result.audio_seconds;
+		std::printf("%9.1f %9.1f %8.1f %8.2f %8.3f %8.3f %8.3f  %s\n",
+		            result.create_ms,
+		            result.load_ms,
+		            realtime_factor,
+		            cpu_percent,
+		            result.p50_ms,
+		            result.p99_ms,
+		            result.max_ms,
+		            result.name.toRawUTF8());
+		std::fflush(stdout);
+
+		csv << "\"" << result.name << "\"," << result.create_ms << "," << result.load_ms << "," << realtime_factor << ","
+		    << cpu_percent << "," << result.p50_ms << "," << result.p99_ms << "," << result.max_ms << "\n";
+
+		profile_csv << "\"" << result.name << "\"";
+		for (int module = 0; module < ModuleProfiler::NumberOfModules; ++module) {
+			profile_csv << "," << result.module_percent[module];
+		}
+		profile_csv << "\n";
+
+		total_render += result.render_seconds;
+		total_audio += result.audio_seconds;
+		if (result.max_ms > worst_max) {
+			worst_max   = result.max_ms;
+			worst_patch = result.name;
+		}
+	}
+
+	std::printf("\ntotal: %.1f s of audio in %.2f s, realtime factor %.1f, worst block %.3f ms (%s), block budget %.3f ms\n",
+	            total_audio,
+	            total_render,
+	            total_render > 0. ? total_audio / total_render : 0.,
+	            worst_max,
+	            worst_patch.toRawUTF8(),
+	            1000. * block_size / samplerate);
+
+	if (csv_file != File() && !csv_file.replaceWithText(csv)) {
+		std::fprintf(stderr, "Couldn't write %s\n", csv_file.getFullPathName().toRawUTF8());
+		return 1;
+	}
+	if (profile_file != File() && !profile_file.replaceWithText(profile_csv)) {
+		std::fprintf(stderr, "Couldn't write %s\n", profile_file.getFullPathName().toRawUTF8());
+		return 1;
+	}
+	return 0;
+}
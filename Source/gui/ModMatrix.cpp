@@ -20,95 +20,40 @@ void ModMatrixRow::setSourcesAndDestinations(ModSources *p_source, ModDestinatio
 	m_destinations = p_destination;
 }
 
-void ModMatrixRow::applyModulation() {
-
-	if (m_active_1) {
-		// poly destination -> #VOICES modulations
-		if (m_destination_1_poly) {
-			for (int voice = 0; voice < VOICES; ++voice) {
-				if (m_scale) {
-					if (m_scale_amount >= 0) {
-						*(m_destination_1_value[voice]) += (*m_source_value[voice]) * m_mod_amount_1 *
-						                                   fabs(m_mod_amount_1) *
-						                                   (1 + (*m_scale_value[voice] - 1) * m_scale_amount);
-					} else {
-						*(m_destination_1_value[voice]) += (*m_source_value[voice]) * m_mod_amount_1 *
-						                                   fabs(m_mod_amount_1) *
-						                                   (1 + fabs(*m_scale_value[voice]) * m_scale_amount);
-					}
-				} else {
-					// DBG("MOD SLOT ACTIVE");
-					*(m_destination_1_value[voice]) += (*m_source_value[voice]) * m_mod_amount_1 * fabs(m_mod_amount_1);
-				}
-			}
-		} else // mono destination
-		{
-			// use most recent voice for poly, for mono all #VOICES are identical so it
-			// doesnt matter
-			if (m_scale) {
-				if (m_scale_amount >= 0) {
-					*(m_destination_1_value[0]) += (*m_source_value[m_most_recent_voice]) * m_mod_amount_1 *
-					                               fabs(m_mod_amount_1) *
-					                               (1 + (*m_scale_value[m_most_recent_voice] - 1) * m_scale_amount);
-				} else {
-					*(m_destination_1_value[0]) += (*m_source_value[m_most_recent_voice]) * m_mod_amount_1 *
-					                               fabs(m_mod_amount_1) *
-					                               (1 + fabs(*m_scale_value[m_most_recent_voice]) * m_scale_amount);
-				}
-			} else {
-				//DBG("dest before: " + std::to_string(*(m_destination_1_value[0])));
-				//DBG("mod amount: " + std::to_string(m_mod_amount_1));
-				//DBG("rec voice: " + std::to_string(m_most_recent_voice));
-				//DBG("source: " + std::to_string((*m_source_value[m_most_recent_voice])));
-
-				*(m_destination_1_value[0]) +=
-				    (*m_source_value[m_most_recent_voice]) * m_mod_amount_1 * fabs(m_mod_amount_1);
-				//DBG("dest after: " + std::to_string(*(m_destination_1_value[0])));
-			}
+int ModRouting::addSource(float *const *p_source_pointers) {
+	for (int source = 0; source < number_of_sources; ++source) {
+		if (!memcmp(sources[source], p_source_pointers, sizeof(sources[source]))) {
+			return source;
 		}
 	}
+	memcpy(sources[number_of_sources], p_source_pointers, sizeof(sources[number_of_sources]));
+	return number_of_sources++;
+}
 
+void ModMatrixRow::compile(ModRouting &p_routing) const {
+	if (m_active_1) {
+		compileSlot(p_routing, m_destination_1_value, m_destination_1_poly, m_mod_amount_1);
+	}
 	if (m_active_2) {
-		// poly destination -> #VOICES modulations
-		if (m_destination_2_poly) {
-			for (int voice = 0; voice < VOICES; ++voice) {
-				if (m_scale) {
-					if (m_scale_amount >= 0) {
-						*(m_destination_2_value[voice]) += (*m_source_value[voice]) * m_mod_amount_2 *
-						                                   fabs(m_mod_amount_2) *
-						                                   (1 + (*m_scale_value[voice] - 1) * m_scale_amount);
-					} else {
-						*(m_destination_2_value[voice]) += (*m_source_value[voice]) * m_mod_amount_2 *
-						                                   fabs(m_mod_amount_2) *
-						                                   (1 + fabs(*m_scale_value[voice]) * m_scale_amount);
-					}
-				} else {
-					// DBG("MOD SLOT ACTIVE");
-					*(m_destination_2_value[voice]) += (*m_source_value[voice]) * m_mod_amount_2 * fabs(m_mod_amount_2);
-				}
-			}
-		} else // mono destination
-		{
-			// use most recent voice for poly, for mono all #VOICES are identical so it
-			// doesnt matter
-			if (m_scale) {
-				if (m_scale_amount >= 0) {
-					*(m_destination_2_value[0]) += (*m_source_value[m_most_recent_voice]) * m_mod_amount_2 *
-					                               fabs(m_mod_amount_2) *
-					                               (1 + (*m_scale_value[m_most_recent_voice] - 1) * m_scale_amount);
-				} else {
-					*(m_destination_2_value[0]) += (*m_source_value[m_most_recent_voice]) * m_mod_amount_2 *
-					                               fabs(m_mod_amount_2) *
-					                               (1 + fabs(*m_scale_value[m_most_recent_voice]) * m_scale_amount);
-				}
-			} else {
-				*(m_destination_2_value[0]) +=
-				    (*m_source_value[m_most_recent_voice]) * m_mod_amount_2 * fabs(m_mod_amount_2);
-			}
-		}
+		compileSlot(p_routing, m_destination_2_value, m_destination_2_poly, m_mod_amount_2);
 	}
 }
 
+void ModMatrixRow::compileSlot(ModRouting &p_routing,
+                               float *const *p_destination_pointers,
+                               bool p_dest_poly,
+                               float p_mod_amount) const {
+	ModRoutingOp &op = p_routing.ops[p_routing.number_of_ops++];
+	op.source        = p_routing.addSource(m_source_value);
+	op.scale         = m_scale ? p_routing.addSource(m_scale_value) : 0;
+	op.destination   = (int)(p_destination_pointers[0] - (float *)m_destinations);
+	op.poly          = p_dest_poly;
+	op.scale_mode    = !m_scale ? ModScaleMode::None
+	                            : (m_scale_amount >= 0 ? ModScaleMode::Positive : ModScaleMode::Negative);
+	op.amount        = p_mod_amount * fabs(p_mod_amount);
+	op.scale_amount  = m_scale_amount;
+}
+
 void ModMatrixRow::setModSource(int p_source) {
 	setModSource(p_source, m_source_value, m_source);
 }
@@ -1061,15 +1006,135 @@ bool ModMatrixRow::usesADSR1() // global env
 	return m_source == 203 || m_scale == 203;
 }
 
+bool ModMatrixRow::usesAudioRateSource() {
+	switch (m_source) {
+	case 100:
+	case 101:
+	case 102:
+	case 110:
+	case 111:
+		return true;
+	}
+	switch (m_scale) {
+	case 100:
+	case 101:
+	case 102:
+	case 110:
+	case 111:
+		return true;
+	}
+	return false;
+}
+
 //=========================================================
 //=================== MODMATRIX ===========================
 //=========================================================
 
 void ModMatrix::applyModulation() {
-	for (int row = 0; row < MODMATRIX_ROWS; ++row) {
-		if (m_row[row]) {
-			m_row[row].applyModulation();
+	// pick up a routing which was compiled since the last call
+	if (m_routing_shared.load() & MOD_ROUTING_NEW) {
+		m_routing_read = m_routing_shared.exchange(m_routing_read) & ~MOD_ROUTING_NEW;
+	}
+	if (m_routing[m_routing_read].number_of_ops) {
+		runRouting(m_routing[m_routing_read]);
+	}
+
+	// voices which just started don't ramp into their first values
+	for (int index = 0; index < *m_number_of_active_voices; ++index) {
+		const int voice = m_active_voices[index];
+		if (m_voice_started[voice]) {
+			m_voice_started[voice]               = false;
+			m_previous_destinations.voice[voice] = m_destinations->voice[voice];
+		}
+	}
+}
+
+void ModMatrix::runRouting(const ModRouting &p_routing) {
+	const int number_of_active_voices = *m_number_of_active_voices;
+
+	// read every source once per voice
+	for (int source = 0; source < p_routing.number_of_sources; ++source) {
+		float *const *source_pointers = p_routing.sources[source];
+		for (int index = 0; index < number_of_active_voices; ++index) {
+			m_gathered_sources[source][index] = *source_pointers[m_active_voices[index]];
+		}
+		// for mono destinations use most recent voice, for mono all #VOICES are identical so it doesnt matter
+		m_gathered_most_recent[source] = *source_pointers[m_most_recent_voice];
+	}
+
+	float *destinations = (float *)m_destinations;
+	for (int op_index = 0; op_index < p_routing.number_of_ops; ++op_index) {
+		const ModRoutingOp &op = p_routing.ops[op_index];
+		const float amount     = op.amount;
+		const float scale      = op.scale_amount;
+
+		if (!op.poly) {
+			float value = m_gathered_most_recent[op.source] * amount;
+			if (op.scale_mode == ModScaleMode::Positive) {
+				value *= 1 + (m_gathered_most_recent[op.scale] - 1) * scale;
+			} else if (op.scale_mode == ModScaleMode::Negative) {
+				value *= 1 + fabs(m_gathered_most_recent[op.scale]) * scale;
+			}
+			destinations[op.destination] += value;
+			continue;
 		}
+
+		// poly destination -> one modulation per active voice
+		const float *source = m_gathered_sources[op.source];
+		const float *scaler = m_gathered_sources[op.scale];
+		switch (op.scale_mode) {
+		case ModScaleMode::None:
+			for (int index = 0; index < number_of_active_voices; ++index) {
+				m_op_values[index] = source[index] * amount;
+			}
+			break;
+		case ModScaleMode::Positive:
+			for (int index = 0; index < number_of_active_voices; ++index) {
+				m_op_values[index] = source[index] * amount * (1 + (scaler[index] - 1) * scale);
+			}
+			break;
+		case ModScaleMode::Negative:
+			for (int index = 0; index < number_of_active_voices; ++index) {
+				m_op_values[index] = source[index] * amount * (1 + fabs(scaler[index]) * scale);
+			}
+			break;
+		}
+
+		float *destination = destinations + op.destination;
+		for (int index = 0; index < number_of_active_voices; ++index) {
+			destination[m_active_voices[index] * MOD_DEST_VOICE_STRIDE] += m_op_values[index];
+		}
+	}
+}
+
+void ModMatrix::compileRouting() {
+	if (m_updating) {
+		m_routing_outdated = true;
+		return;
+	}
+
+	ModRouting &routing       = m_routing[m_routing_write];
+	routing.number_of_sources = 0;
+	routing.number_of_ops     = 0;
+	for (int row = 0; row < MODMATRIX_ROWS; ++row) {
+		m_row[row].compile(routing);
+	}
+	m_routing_write = m_routing_shared.exchange(m_routing_write | MOD_ROUTING_NEW) & ~MOD_ROUTING_NEW;
+}
+
+void ModMatrix::beginUpdate() {
+	m_updating = true;
+}
+
+void ModMatrix::endUpdate() {
+	m_updating = false;
+	if (m_sources_outdated) {
+		m_sources_outdated = false;
+		checkWhichSourceToRender();
+	}
+	if (m_routing_outdated) {
+		m_routing_outdated = false;
+		compileRouting();
 	}
 }
 
@@ -1081,6 +1146,12 @@ void ModMatrix::setSourcesAndDestinations(ModSources *p_sources, ModDestinations
 	m_destinations = p_destinations;
 	zeroAllDestinations();
 	zeroAllSources();
+	compileRouting();
+}
+
+void ModMatrix::setActiveVoices(const int *p_active_voices, const int *p_number_of_active_voices) {
+	m_active_voices           = p_active_voices;
+	m_number_of_active_voices = p_number_of_active_voices;
 }
 
 // ModMatrix::ModMatrix(ModSources *p_sources, ModDestinations
@@ -1093,31 +1164,36 @@ void ModMatrix::setSourcesAndDestinations(ModSources *p_sources, ModDestinations
 void ModMatrix::setModSource(int p_row, int p_source) {
 	m_row[p_row].setModSource(p_source);
 	checkWhichSourceToRender();
+	compileRouting();
 }
 
 void ModMatrix::setModDestination1(int p_row, int p_destination) {
 	m_row[p_row].setModDestination1(p_destination);
+	compileRouting();
 }
 void ModMatrix::setModDestination2(int p_row, int p_destination) {
 	m_row[p_row].setModDestination2(p_destination);
-	// DBG("row: " + std::to_string(p_row));
+	compileRouting();
 }
 
 void ModMatrix::setModScale(int p_row, int p_scale) {
 	m_row[p_row].setModScale(p_scale);
 	checkWhichSourceToRender();
+	compileRouting();
 }
 
 void ModMatrix::setModAmount1(int p_row, float p_mod_amount) {
 	m_row[p_row].setModAmount1(p_mod_amount);
+	compileRouting();
 }
 void ModMatrix::setModAmount2(int p_row, float p_mod_amount) {
 	m_row[p_row].setModAmount2(p_mod_amount);
-	// DBG("row: " + std::to_string(p_row));
+	compileRouting();
 }
 
 void ModMatrix::setScaleAmount(int p_row, float p_scale_amount) {
 	m_row[p_row].setScaleAmount(p_scale_amount);
+	compileRouting();
 }
 
 void ModMatrix::zeroAllSources() {
@@ -1126,11 +1202,37 @@ void ModMatrix::zeroAllSources() {
 
 void ModMatrix::zeroAllDestinations() {
 	memset(m_destinations, 0, sizeof(ModDestinations));
+	memset(&m_previous_destinations, 0, sizeof(ModDestinations));
+}
+
+void ModMatrix::zeroActiveDestinations() {
+	for (int index = 0; index < *m_number_of_active_voices; ++index) {
+		const int voice                      = m_active_voices[index];
+		m_previous_destinations.voice[voice] = m_destinations->voice[voice];
+		memset(&(m_destinations->voice[voice]), 0, sizeof(ModDestVoice));
+	}
+	// everything behind the voices is global
+	const size_t global_size = sizeof(ModDestinations) - sizeof(m_destinations->voice);
+	memcpy((char *)&m_previous_destinations + sizeof(m_destinations->voice),
+	       (char *)m_destinations + sizeof(m_destinations->voice),
+	       global_size);
+	memset((char *)m_destinations + sizeof(m_destinations->voice), 0, global_size);
+}
+
+void ModMatrix::zeroVoiceDestinations(int p_voice) {
+	memset(&(m_destinations->voice[p_voice]), 0, sizeof(ModDestVoice));
+	m_voice_started[p_voice] = true;
 }
 
 void ModMatrix::checkWhichSourceToRender() {
+	if (m_updating) {
+		m_sources_outdated = true;
+		return;
+	}
+
 	bool render_LFO[4]  = {0};
 	bool render_ADSR[2] = {0};
+	bool audio_rate     = false;
 
 	for (int row = 0; row < MODMATRIX_ROWS; ++row) {
 		render_LFO[0] = m_row[row].usesLFO0() ? true : render_LFO[0];
@@ -1140,7 +1242,10 @@ void ModMatrix::checkWhichSourceToRender() {
 
 		render_ADSR[0] = m_row[row].usesADSR0() ? true : render_ADSR[0];
 		render_ADSR[1] = m_row[row].usesADSR1() ? true : render_ADSR[1];
+
+		audio_rate = m_row[row].usesAudioRateSource() ? true : audio_rate;
 	}
+	m_uses_audio_rate_sources = audio_rate;
 
 	setSourcesToRender(render_LFO[0], render_LFO[1], render_LFO[2], render_LFO[3], render_ADSR[0], render_ADSR[1]);
 }
\ No newline at end of file
@@ -16,6 +16,7 @@
 
 #pragma once
 #include "../GlobalIncludes.h"
+#include <atomic>
 #include <cstring>
 
 // contains all modulation destinations in an oscillator (all types)
@@ -178,6 +179,36 @@ struct ModSources {
   float* sustain_pedal;
 };
 
+#define MOD_ROUTING_MAX_OPS (MODMATRIX_ROWS * 2)
+#define MOD_ROUTING_MAX_SOURCES (MODMATRIX_ROWS * 2) // source and scale of each row
+#define MOD_ROUTING_NEW 4 // flag in ModMatrix::m_routing_shared
+#define MOD_DEST_VOICE_STRIDE ((int)(sizeof(ModDestVoice) / sizeof(float)))
+
+enum class ModScaleMode { None, Positive, Negative };
+
+// one modulation slot of an active row. Offsets count floats from the start of ModDestinations
+struct ModRoutingOp {
+  int source;         // index into ModRouting::sources
+  int scale;          // index into ModRouting::sources, only used with a scale mode
+  int destination;    // offset of the destination, for poly destinations the one of voice 0
+  bool poly;
+  ModScaleMode scale_mode;
+  float amount;       // already squared with the sign kept
+  float scale_amount;
+};
+
+// the active rows of the matrix flattened into a list of ops. Every distinct source is read once per
+// voice, the ops then work on the gathered values only
+struct ModRouting {
+  // returns the index of the source, adds it if it isn't in the list yet
+  int addSource(float *const *p_source_pointers);
+
+  float *sources[MOD_ROUTING_MAX_SOURCES][VOICES];
+  int number_of_sources = 0;
+  ModRoutingOp ops[MOD_ROUTING_MAX_OPS];
+  int number_of_ops = 0;
+};
+
 class ModMatrixRow {
 public:
   ModMatrixRow(){}
@@ -188,7 +219,8 @@ public:
     return m_active_1 || m_active_2;
   }
 
-  void applyModulation();
+  // appends the ops of the active slots of this row
+  void compile(ModRouting &p_routing) const;
 
   //this sets for source and scale
   void setModSource(int p_source, float** p_source_pointers, int& p_source_store);
@@ -213,10 +245,6 @@ public:
     m_scale_amount = p_scale_amount;
   }
 
-  void setMostRecentVoice(int p_voice){
-    m_most_recent_voice = p_voice;
-  }
-  
   void setModDestination1(int p_destination);
   void setModDestination2(int p_destination);
 
@@ -226,9 +254,11 @@ public:
   bool usesLFO3();//global
   bool usesADSR0();//mod
   bool usesADSR1();//global
+  bool usesAudioRateSource();//osc or filter outputs
 
 private:
-  int m_most_recent_voice = 0;
+  void compileSlot(ModRouting &p_routing, float *const *p_destination_pointers, bool p_dest_poly,
+                   float p_mod_amount) const;
 
   int m_source = 0;
   int m_destination_1 = 0;
@@ -250,7 +280,6 @@ private:
   bool m_destination_2_poly = false;
   bool m_source_poly = false;
 
-
   ModSources* m_sources;
   ModDestinations* m_destinations;
 };
@@ -260,7 +289,9 @@ public:
   ModMatrix(){}
 
   void setSourcesAndDestinations(ModSources *p_source, ModDestinations *p_destination);
+  void setActiveVoices(const int *p_active_voices, const int *p_number_of_active_voices);
 
+  // runs the compiled routing once for the current values of the sources
   void applyModulation();
 
   void setModSource(int p_row, int p_source);
@@ -272,20 +303,65 @@ public:
   void setScaleAmount(int p_row, float p_scale_amount);
   void setMostRecentVoice(int p_voice){
     m_most_recent_voice = p_voice;
-    for(int row = 0; row < MODMATRIX_ROWS; ++row){
-      m_row[row].setMostRecentVoice(p_voice);
-    }
   }
   void checkWhichSourceToRender();
 
+  // between these the setters only remember that the routing is outdated, endUpdate() compiles it once.
+  // Used to load a whole patch at once
+  void beginUpdate();
+  void endUpdate();
+
+  // if true, the modmatrix has to be evaluated on every sample
+  bool usesAudioRateSources(){
+    return m_uses_audio_rate_sources;
+  }
 
   void zeroAllSources();
   void zeroAllDestinations();
+  // only clears the destinations of sounding voices and the global ones, after keeping their values for
+  // getPreviousValue()
+  void zeroActiveDestinations();
+  // clears a voice which starts to sound, it doesn't ramp from its old values
+  void zeroVoiceDestinations(int p_voice);
+
+  // value the destination had in the last sub-block, modules ramp from there to the current value
+  float getPreviousValue(const float *p_destination) const {
+    return ((const float *)&m_previous_destinations)[p_destination - (const float *)m_destinations];
+  }
 
   std::function<void(bool, bool, bool, bool, bool, bool)> setSourcesToRender;
 private:
+  // flattens the rows into a new routing and hands it to the audio thread. Called by all setters,
+  // which all run on the message thread
+  void compileRouting();
+  void runRouting(const ModRouting &p_routing);
+
   int m_most_recent_voice = 0;
+  bool m_uses_audio_rate_sources = false;
   ModMatrixRow m_row[MODMATRIX_ROWS];
   ModSources* m_sources;
   ModDestinations* m_destinations;
+
+  // poly destinations are only written for sounding voices
+  const int* m_active_voices = nullptr;
+  const int* m_number_of_active_voices = nullptr;
+
+  ModDestinations m_previous_destinations;
+  bool m_voice_started[VOICES] = {false};
+
+  // triple buffer: the message thread compiles into the write routing, the audio thread runs the read
+  // routing and they swap through the shared index without ever using the same one
+  ModRouting m_routing[3];
+  int m_routing_write = 1;
+  int m_routing_read = 0;
+  std::atomic<int> m_routing_shared{2};
+
+  bool m_updating = false;
+  bool m_routing_outdated = false;
+  bool m_sources_outdated = false;
+
+  // source values of the active voices, indexed like the active voice list
+  float m_gathered_sources[MOD_ROUTING_MAX_SOURCES][VOICES];
+  float m_gathered_most_recent[MOD_ROUTING_MAX_SOURCES];
+  float m_op_values[VOICES];
 };
\ No newline at end of file
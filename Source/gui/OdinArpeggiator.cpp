@@ -17,8 +17,6 @@
 #include <algorithm>
 #include <random>
 
-#define NO_NOTE std::make_tuple(-1, 0, 0.f, 0.f)
-
 bool sortKeysDownToUp(std::pair<int, int> a, std::pair<int, int> b) {
 	return a.first < b.first;
 }
@@ -27,6 +25,9 @@ bool sortKeysUpToDown(std::pair<int, int> a, std::pair<int, int> b) {
 	return a.first > b.first;
 }
 
+OdinArpeggiator::OdinArpeggiator() : m_RNG(std::random_device{}()) {
+}
+
 String OdinArpeggiator::ArpPatternToString(ArpPattern p_pattern) {
 	switch (p_pattern) {
 	case ArpPattern::Up:
@@ -52,18 +53,53 @@ String OdinArpeggiator::ArpPatternToString(ArpPattern p_pattern) {
 	}
 }
 
-std::tuple<int, int, float, float> OdinArpeggiator::getNoteOns(int &pio_step_active) {
+int OdinArpeggiator::renderEvents(int p_num_samples) {
 	jassert(m_samplerate > 0);
+	jassert(p_num_samples <= SUB_BLOCK_SIZE);
+
+	m_number_of_events = 0;
+	for (int sample = 0; sample < p_num_samples; ++sample) {
+		tickNoteOn(sample);
+		tickNoteOffs(sample);
+	}
+	return m_number_of_events;
+}
+
+void OdinArpeggiator::addEvent(
+    int p_sample, bool p_note_on, int p_note, int p_velocity, float p_mod_1, float p_mod_2) {
+	jassert(m_number_of_events < ARP_MAX_EVENTS);
+	if (m_number_of_events < ARP_MAX_EVENTS) {
+		m_events[m_number_of_events++] = {p_sample, p_note_on, p_note, p_velocity, p_mod_1, p_mod_2};
+	}
+}
 
+void OdinArpeggiator::startNote(int p_sample) {
+	//skip the note rather than losing track of its note off
+	if (m_number_of_playing_notes >= ARP_MAX_PLAYING_NOTES) {
+		jassertfalse;
+		return;
+	}
+	const std::pair<int, int> &note = m_arp_sequence[m_current_arp_index];
+	const int transposed_note       = note.first + m_transpose_steps[m_current_sequence_index];
+	m_playing_notes[m_number_of_playing_notes++] = std::make_pair(transposed_note, 0.f);
+	addEvent(p_sample,
+	         true,
+	         transposed_note,
+	         note.second,
+	         m_mod_1_steps[m_current_sequence_index],
+	         m_mod_2_steps[m_current_sequence_index]);
+}
+
+void OdinArpeggiator::tickNoteOn(int p_sample) {
 	if (m_oneshot_end_reached) {
-		pio_step_active = -1;
-		return NO_NOTE;
+		m_step_active = -1;
+		return;
 	}
 
 	//pattern is empty, nothing to do
-	if (m_arp_sequence.size() == 0) {
-		pio_step_active = -1;
-		return NO_NOTE;
+	if (m_arp_sequence_length == 0) {
+		m_step_active = -1;
+		return;
 	}
 
 	//increment time
@@ -81,27 +117,21 @@ std::tuple<int, int, float, float> OdinArpeggiator::getNoteOns(int &pio_step_act
 		m_start_pattern          = false;
 		m_current_arp_index      = 0;
 		m_current_sequence_index = 0;
-		pio_step_active          = 0;
+		m_step_active            = 0;
 		m_time_since_last_note   = 0.f;
 		if (m_sequence_steps_on[m_current_sequence_index]) {
-			m_playing_notes.push_back(std::make_pair(
-			    m_arp_sequence[m_current_arp_index].first + m_transpose_steps[m_current_sequence_index], 0.f));
-			return transposeSemi(m_arp_sequence[m_current_arp_index],
-			                     m_transpose_steps[m_current_sequence_index],
-			                     m_mod_1_steps[m_current_sequence_index],
-			                     m_mod_2_steps[m_current_sequence_index]);
-		} else {
-			return NO_NOTE;
+			startNote(p_sample);
 		}
+		return;
 	}
 
 	//start new note?
 	if (m_time_since_last_note > m_arp_time) {
 		++m_current_arp_index;
-		if (m_current_arp_index >= m_arp_sequence.size()) {
+		if (m_current_arp_index >= m_arp_sequence_length) {
 			//updown skips a beat when wrapping
 			if ((m_pattern == ArpPattern::UpAndDown || m_pattern == ArpPattern::DownAndUp) &&
-			    m_arp_sequence.size() > 1) {
+			    m_arp_sequence_length > 1) {
 				m_current_arp_index = 1;
 			} else if (m_pattern == ArpPattern::Random) {
 				//arp needs to be redone every pattern
@@ -116,50 +146,44 @@ std::tuple<int, int, float, float> OdinArpeggiator::getNoteOns(int &pio_step_act
 			m_current_sequence_index = 0;
 			if (m_oneshot) {
 				m_current_sequence_index = 0;
-				pio_step_active          = -1;
+				m_step_active            = -1;
 				m_oneshot_end_reached    = true;
-				return NO_NOTE;
+				return;
 			}
 		}
-		pio_step_active        = m_current_sequence_index;
+		m_step_active          = m_current_sequence_index;
 		m_time_since_last_note = 0.f;
 
 		if (m_sequence_steps_on[m_current_sequence_index]) {
-			m_playing_notes.push_back(std::make_pair(
-			    m_arp_sequence[m_current_arp_index].first + m_transpose_steps[m_current_sequence_index], 0.f));
-			return transposeSemi(m_arp_sequence[m_current_arp_index],
-			                     m_transpose_steps[m_current_sequence_index],
-			                     m_mod_1_steps[m_current_sequence_index],
-			                     m_mod_2_steps[m_current_sequence_index]);
+			startNote(p_sample);
+			return;
 		}
 	}
 
 	//well then do nothing I guess
-	pio_step_active = m_current_sequence_index;
-	return NO_NOTE;
+	m_step_active = m_current_sequence_index;
 }
 
-std::vector<int> OdinArpeggiator::getNoteOffs() {
-	std::vector<int> ret;
-	for (int note = 0; note < m_playing_notes.size(); ++note) {
-		m_playing_notes[note].second += m_one_over_samplerate * m_speed_mod_factor;
-		float gate_modded = m_gate;
-		if(*m_gate_mod > 0){
-			gate_modded += *m_gate_mod;
-		} else if(*m_gate_mod < 0){
-			gate_modded += *m_gate_mod * m_gate;
-			gate_modded = gate_modded < 0.f ? 0.f : gate_modded;
-		}
+void OdinArpeggiator::tickNoteOffs(int p_sample) {
+	float gate_modded = m_gate;
+	if (*m_gate_mod > 0) {
+		gate_modded += *m_gate_mod;
+	} else if (*m_gate_mod < 0) {
+		gate_modded += *m_gate_mod * m_gate;
+		gate_modded = gate_modded < 0.f ? 0.f : gate_modded;
+	}
 
+	int kept_notes = 0;
+	for (int note = 0; note < m_number_of_playing_notes; ++note) {
+		m_playing_notes[note].second += m_one_over_samplerate * m_speed_mod_factor;
 		if (m_playing_notes[note].second > m_arp_time * gate_modded) {
-			ret.push_back(m_playing_notes[note].first);
-			m_playing_notes.erase(m_playing_notes.begin() + note);
-			//go one back since we deleted one
-			--note;
+			addEvent(p_sample, false, m_playing_notes[note].first, 0, 0.f, 0.f);
+		} else {
+			//keep the order of the remaining notes
+			m_playing_notes[kept_notes++] = m_playing_notes[note];
 		}
 	}
-
-	return ret;
+	m_number_of_playing_notes = kept_notes;
 }
 
 void OdinArpeggiator::setSampleRate(double p_samplerate) {
@@ -175,15 +199,17 @@ void OdinArpeggiator::reset() {
 void OdinArpeggiator::midiNoteOn(int p_midi_note, int p_midi_velocity) {
 	if (m_sustain_active) {
 		//in sustain avoid adding double notes:
-		for (auto note : m_active_keys_and_velocities) {
-			if (note.first == p_midi_note) {
+		for (int key = 0; key < m_number_of_active_keys; ++key) {
+			if (m_active_keys_and_velocities[key].first == p_midi_note) {
 				//this note is already on, remove it from kill list if necessary
-				for (int kill = 0; kill < m_sustain_kill_list.size(); ++kill) {
+				for (int kill = 0; kill < m_sustain_kill_list_size; ++kill) {
 					if (m_sustain_kill_list[kill] == p_midi_note) {
-						m_sustain_kill_list.erase(m_sustain_kill_list.begin() + kill);
+						for (int next = kill + 1; next < m_sustain_kill_list_size; ++next) {
+							m_sustain_kill_list[next - 1] = m_sustain_kill_list[next];
+						}
+						--m_sustain_kill_list_size;
 						//DBG("ERASED FROM KILLIST: " + std::to_string(p_midi_note));
 						//printKillList();
-						--kill;
 						break;
 					}
 				}
@@ -191,9 +217,12 @@ void OdinArpeggiator::midiNoteOn(int p_midi_note, int p_midi_velocity) {
 			}
 		}
 	}
-	m_active_keys_and_velocities.push_back(std::make_pair(p_midi_note, p_midi_velocity));
+	if (m_number_of_active_keys >= ARP_MAX_KEYS) {
+		return;
+	}
+	m_active_keys_and_velocities[m_number_of_active_keys++] = std::make_pair(p_midi_note, p_midi_velocity);
 	//DBG("NOTEON: " + std::to_string(p_midi_note));
-	if (m_active_keys_and_velocities.size() == 1) {
+	if (m_number_of_active_keys == 1) {
 		m_start_pattern = true;
 	}
 	generateSequence();
@@ -201,17 +230,25 @@ void OdinArpeggiator::midiNoteOn(int p_midi_note, int p_midi_velocity) {
 }
 
 void OdinArpeggiator::midiNoteOff(int p_midi_note) {
-	for (int key = 0; key < m_active_keys_and_velocities.size(); ++key) {
+	for (int key = 0; key < m_number_of_active_keys; ++key) {
 		if (m_active_keys_and_velocities[key].first == p_midi_note) {
 			if (m_sustain_active) {
-				m_sustain_kill_list.push_back(p_midi_note);
+				bool on_kill_list = false;
+				for (int kill = 0; kill < m_sustain_kill_list_size; ++kill) {
+					on_kill_list |= m_sustain_kill_list[kill] == p_midi_note;
+				}
+				if (!on_kill_list && m_sustain_kill_list_size < ARP_MAX_KEYS) {
+					m_sustain_kill_list[m_sustain_kill_list_size++] = p_midi_note;
+				}
 				//DBG("ADDED TO KILL LIST: " + std::to_string(p_midi_note));
 				//printKillList();
 			} else {
-				m_active_keys_and_velocities.erase(m_active_keys_and_velocities.begin() + key);
+				for (int next = key + 1; next < m_number_of_active_keys; ++next) {
+					m_active_keys_and_velocities[next - 1] = m_active_keys_and_velocities[next];
+				}
+				--m_number_of_active_keys;
 				//in case we have the same note two times in a row (they are sorted):
 				--key;
-				generateSequence();
 				//DBG("ENDED BY NOTEOFF: " + std::to_string(p_midi_note));
 			}
 		}
@@ -221,19 +258,17 @@ void OdinArpeggiator::midiNoteOff(int p_midi_note) {
 
 void OdinArpeggiator::endPlayingNotes() {
 	//set timer to max, so it ends on next sample
-	std::vector<std::pair<int, float>> ret;
-	for (auto note : m_playing_notes) {
-		ret.push_back(std::make_pair(note.first, std::numeric_limits<float>::max()));
+	for (int note = 0; note < m_number_of_playing_notes; ++note) {
+		m_playing_notes[note].second = std::numeric_limits<float>::max();
 	}
-	m_playing_notes = ret;
 }
 
 void OdinArpeggiator::allMidiNotesOff() {
 	endPlayingNotes();
-	m_active_keys_and_velocities.clear();
-	m_sustain_kill_list.clear();
+	m_number_of_active_keys  = 0;
+	m_sustain_kill_list_size = 0;
 	//printKillList();
-	m_arp_sequence.clear();
+	m_arp_sequence_length = 0;
 	m_current_arp_index = -1;
 }
 
@@ -246,11 +281,11 @@ void OdinArpeggiator::setSustainActive(bool p_sustain_active) {
 
 void OdinArpeggiator::executeKillList() {
 	// we are now in sustain off, so midinoteoff kills notes for sure
-	for (auto key : m_sustain_kill_list) {
-		//DBG("EXECUTE: " + std::to_string(key));
-		midiNoteOff(key);
+	for (int kill = 0; kill < m_sustain_kill_list_size; ++kill) {
+		//DBG("EXECUTE: " + std::to_string(m_sustain_kill_list[kill]));
+		midiNoteOff(m_sustain_kill_list[kill]);
 	}
-	m_sustain_kill_list.clear();
+	m_sustain_kill_list_size = 0;
 	//printKillList();
 	generateSequence();
 }
@@ -263,136 +298,89 @@ std::pair<int, int> OdinArpeggiator::transposeOct(std::pair<int, int> p_note, in
 	return std::make_pair(p_note.first + 12 * p_octave, p_note.second);
 }
 
-std::tuple<int, int, float, float> OdinArpeggiator::transposeSemi(std::pair<int, int> p_note,
-                                                                  int p_semitones,
-                                                                  float p_mod_1,
-                                                                  float p_mod_2) {
-	return std::make_tuple(p_note.first + p_semitones, p_note.second, p_mod_1, p_mod_2);
+void OdinArpeggiator::sortKeys(bool p_up) {
+	std::sort(m_active_keys_and_velocities,
+	          m_active_keys_and_velocities + m_number_of_active_keys,
+	          p_up ? sortKeysDownToUp : sortKeysUpToDown);
+}
+
+void OdinArpeggiator::appendOctaves(bool p_up, bool p_skip_first) {
+	for (int index = 0; index < m_octaves; ++index) {
+		const int octave = p_up ? index : m_octaves - 1 - index;
+		for (int key = 0; key < m_number_of_active_keys; ++key) {
+			if (p_skip_first) {
+				p_skip_first = false;
+			} else {
+				m_arp_sequence[m_arp_sequence_length++] = transposeOct(m_active_keys_and_velocities[key], octave);
+			}
+		}
+	}
+}
+
+void OdinArpeggiator::appendCrawl(bool p_up) {
+	int number_of_octave_keys = 0;
+	for (int index = 0; index < m_octaves; ++index) {
+		const int octave = p_up ? index : m_octaves - 1 - index;
+		for (int key = 0; key < m_number_of_active_keys; ++key) {
+			m_octave_keys[number_of_octave_keys++] = transposeOct(m_active_keys_and_velocities[key], octave);
+		}
+	}
+	for (int crawl_index = 0; crawl_index < number_of_octave_keys - m_number_of_active_keys + 1; ++crawl_index) {
+		for (int sub_index = 0; sub_index < m_number_of_active_keys; ++sub_index) {
+			m_arp_sequence[m_arp_sequence_length++] = m_octave_keys[crawl_index + sub_index];
+		}
+	}
+	//ovoid empty pattern:
+	if (m_arp_sequence_length == 0 && m_number_of_active_keys >= 1) {
+		m_arp_sequence[m_arp_sequence_length++] = m_active_keys_and_velocities[0];
+	}
 }
 
 void OdinArpeggiator::generateSequence() {
 
-	m_arp_sequence.clear();
+	m_arp_sequence_length = 0;
 	switch (m_pattern) {
 	case ArpPattern::Up:
-		std::sort(m_active_keys_and_velocities.begin(), m_active_keys_and_velocities.end(), sortKeysDownToUp);
-		for (int octave = 0; octave < m_octaves; ++octave) {
-			for (auto note : m_active_keys_and_velocities) {
-				m_arp_sequence.push_back(transposeOct(note, octave));
-			}
-		}
+		sortKeys(true);
+		appendOctaves(true, false);
 		break;
 	case ArpPattern::Down:
-		std::sort(m_active_keys_and_velocities.begin(), m_active_keys_and_velocities.end(), sortKeysUpToDown);
-		for (int octave = m_octaves - 1; octave >= 0; --octave) {
-			for (auto note : m_active_keys_and_velocities) {
-				m_arp_sequence.push_back(transposeOct(note, octave));
-			}
-		}
+		sortKeys(false);
+		appendOctaves(false, false);
 		break;
 	case ArpPattern::UpAndDown:
-		std::sort(m_active_keys_and_velocities.begin(), m_active_keys_and_velocities.end(), sortKeysDownToUp);
-		for (int octave = 0; octave < m_octaves; ++octave) {
-			for (auto note : m_active_keys_and_velocities) {
-				m_arp_sequence.push_back(transposeOct(note, octave));
-			}
-		}
-		std::sort(m_active_keys_and_velocities.begin(), m_active_keys_and_velocities.end(), sortKeysUpToDown);
-		{
-			bool first_note = true;
-			for (int octave = m_octaves - 1; octave >= 0; --octave) {
-				for (auto note : m_active_keys_and_velocities) {
-					//omit first note when going down again
-					if (first_note) {
-						first_note = false;
-					} else {
-						m_arp_sequence.push_back(transposeOct(note, octave));
-					}
-				}
-			}
-		}
+		sortKeys(true);
+		appendOctaves(true, false);
+		//omit first note when going down again
+		sortKeys(false);
+		appendOctaves(false, true);
 		break;
-
 	case ArpPattern::DownAndUp:
-		std::sort(m_active_keys_and_velocities.begin(), m_active_keys_and_velocities.end(), sortKeysUpToDown);
-		for (int octave = m_octaves - 1; octave >= 0; --octave) {
-			for (auto note : m_active_keys_and_velocities) {
-				m_arp_sequence.push_back(transposeOct(note, octave));
-			}
-		}
-		std::sort(m_active_keys_and_velocities.begin(), m_active_keys_and_velocities.end(), sortKeysDownToUp);
-		{
-			bool first_note = true;
-			for (int octave = 0; octave < m_octaves; ++octave) {
-				for (auto note : m_active_keys_and_velocities) {
-					//omit first note when going down again
-					if (first_note) {
-						first_note = false;
-					} else {
-						m_arp_sequence.push_back(transposeOct(note, octave));
-					}
-				}
-			}
-		}
+		sortKeys(false);
+		appendOctaves(false, false);
+		sortKeys(true);
+		appendOctaves(true, true);
 		break;
 	case ArpPattern::Random:
 		//do up pattern and shuffle it
-		std::sort(m_active_keys_and_velocities.begin(), m_active_keys_and_velocities.end(), sortKeysDownToUp);
-		for (int octave = 0; octave < m_octaves; ++octave) {
-			for (auto note : m_active_keys_and_velocities) {
-				m_arp_sequence.push_back(transposeOct(note, octave));
-			}
-		}
-		{
-			std::default_random_engine RNG(std::random_device{}());
-			std::shuffle(std::begin(m_arp_sequence), std::end(m_arp_sequence), RNG);
-		}
+		sortKeys(true);
+		appendOctaves(true, false);
+		std::shuffle(m_arp_sequence, m_arp_sequence + m_arp_sequence_length, m_RNG);
+		break;
+	case ArpPattern::CrawlUp:
+		sortKeys(true);
+		appendCrawl(true);
+		break;
+	case ArpPattern::CrawlDown:
+		sortKeys(false);
+		appendCrawl(false);
 		break;
-	case ArpPattern::CrawlUp: {
-		std::sort(m_active_keys_and_velocities.begin(), m_active_keys_and_velocities.end(), sortKeysDownToUp);
-		std::vector<std::pair<int, int>> temp_arp_index;
-		for (int octave = 0; octave < m_octaves; ++octave) {
-			for (auto note : m_active_keys_and_velocities) {
-				temp_arp_index.push_back(transposeOct(note, octave));
-			}
-		}
-		for (int crawl_index = 0;
-		     crawl_index < (int)temp_arp_index.size() - (int)m_active_keys_and_velocities.size() + 1;
-		     ++crawl_index) {
-			for (int sub_index = 0; sub_index < m_active_keys_and_velocities.size(); ++sub_index) {
-				m_arp_sequence.push_back(temp_arp_index[crawl_index + sub_index]);
-			}
-		}
-		//ovoid empty pattern:
-		if (m_arp_sequence.size() == 0 && m_active_keys_and_velocities.size() >= 1) {
-			m_arp_sequence.push_back(m_active_keys_and_velocities[0]);
-		}
-	} break;
-	case ArpPattern::CrawlDown: {
-		std::sort(m_active_keys_and_velocities.begin(), m_active_keys_and_velocities.end(), sortKeysUpToDown);
-		std::vector<std::pair<int, int>> temp_arp_index;
-		for (int octave = m_octaves - 1; octave >= 0; --octave) {
-			for (auto note : m_active_keys_and_velocities) {
-				temp_arp_index.push_back(transposeOct(note, octave));
-			}
-		}
-		for (int crawl_index = 0;
-		     crawl_index < (int)temp_arp_index.size() - (int)m_active_keys_and_velocities.size() + 1;
-		     ++crawl_index) {
-			for (int sub_index = 0; sub_index < m_active_keys_and_velocities.size(); ++sub_index) {
-				m_arp_sequence.push_back(temp_arp_index[crawl_index + sub_index]);
-			}
-		}
-		if (m_arp_sequence.size() == 0 && m_active_keys_and_velocities.size() >= 1) {
-			m_arp_sequence.push_back(m_active_keys_and_velocities[0]);
-		}
-	} break;
 	default:
 		break;
 	}
 
 	//kill arp if all notes off:
-	if (m_arp_sequence.size() == 0) {
+	if (m_arp_sequence_length == 0) {
 		endPlayingNotes();
 	}
 	//printSequence();
@@ -401,8 +389,8 @@ void OdinArpeggiator::generateSequence() {
 void OdinArpeggiator::printSequence() {
 #ifdef ODIN_DEBUG
 	DBG("Current sequence:");
-	for (auto note : m_arp_sequence) {
-		DBG("Key: " + String(note.first) + ", Vel: " + String(note.second));
+	for (int index = 0; index < m_arp_sequence_length; ++index) {
+		DBG("Key: " + String(m_arp_sequence[index].first) + ", Vel: " + String(m_arp_sequence[index].second));
 	}
 	DBG("----");
 #endif
@@ -430,7 +418,7 @@ void OdinArpeggiator::setSynctimeDenominator(float p_value) {
 }
 
 void OdinArpeggiator::setOctaves(int p_new_value) {
-	m_octaves = p_new_value;
+	m_octaves = jlimit(1, ARP_MAX_OCTAVES, p_new_value);
 	generateSequence();
 }
 
@@ -465,9 +453,8 @@ void OdinArpeggiator::setStepMod2(int p_step, float p_mod) {
 
 void OdinArpeggiator::printKillList() {
 	DBG("KList:");
-	for (auto key : m_sustain_kill_list) {
-		(void)key;//<- hide compile warning
-		DBG(key);
+	for (int kill = 0; kill < m_sustain_kill_list_size; ++kill) {
+		DBG(m_sustain_kill_list[kill]);
 	}
 	DBG("------");
 }
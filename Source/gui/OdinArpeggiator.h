@@ -17,9 +17,27 @@
 
 #include "../JuceLibraryCode/JuceHeader.h"
 #include "../GlobalIncludes.h"
+#include <random>
 #include <utility>
 
 #define NUMBER_SEQUENCE_STEPS 16
+#define ARP_MAX_KEYS 32 // further keys are ignored
+#define ARP_MAX_OCTAVES 4
+// the crawl patterns are the longest
+#define ARP_MAX_SEQUENCE_LENGTH (((ARP_MAX_OCTAVES - 1) * ARP_MAX_KEYS + 1) * ARP_MAX_KEYS)
+#define ARP_MAX_PLAYING_NOTES 64
+// one note on per sample plus the note offs of all notes which can be playing
+#define ARP_MAX_EVENTS (2 * SUB_BLOCK_SIZE + ARP_MAX_PLAYING_NOTES)
+
+// a note the arp wants to start or end, timestamped relative to the start of renderEvents()
+struct ArpEvent {
+	int sample;
+	bool note_on;
+	int note;
+	int velocity;
+	float mod_1;
+	float mod_2;
+};
 
 class OdinArpeggiator {
 public:
@@ -36,10 +54,24 @@ public:
 		CrawlDownUp = 90,
 	};
 
+	OdinArpeggiator();
+
 	static String ArpPatternToString(ArpPattern p_pattern);
 
-	std::tuple<int, int, float, float> getNoteOns(int &pio_step_active);
-	std::vector<int> getNoteOffs();
+	// advances the arp by p_num_samples (at most SUB_BLOCK_SIZE) and returns the number of events it produced,
+	// which are sorted by time. Nothing in here allocates
+	int renderEvents(int p_num_samples);
+	const ArpEvent *getEvents() const {
+		return m_events;
+	}
+	// sequence step at the end of the last renderEvents(), -1 if none
+	int getStepActive() const {
+		return m_step_active;
+	}
+	// no keys are held and no notes are playing, so renderEvents() won't produce any events
+	bool isIdle() const {
+		return m_number_of_active_keys == 0 && m_number_of_playing_notes == 0;
+	}
 
 	void setSampleRate(double p_samplerate);
 	void reset();
@@ -76,14 +108,17 @@ private:
 
 	void executeKillList();
 	void generateSequence();
+	void sortKeys(bool p_up);
+	void appendOctaves(bool p_up, bool p_skip_first);
+	void appendCrawl(bool p_up);
+	void tickNoteOn(int p_sample);
+	void tickNoteOffs(int p_sample);
+	void addEvent(int p_sample, bool p_note_on, int p_note, int p_velocity, float p_mod_1, float p_mod_2);
+	void startNote(int p_sample);
 	void calcArpTime();
 
 	void printSequence();
 	std::pair<int, int> transposeOct(std::pair<int, int> note, int p_ocatve);
-	std::tuple<int, int, float, float> transposeSemi(std::pair<int, int> p_note,
-	                                                 int p_semitones,
-	                                                 float p_mod_1,
-	                                                 float p_mod_2);
 	float m_synctime_numerator   = 2.f;
 	float m_synctime_denominator = 16.f;
 	float m_synctime_ratio       = 2.f / 16.f;
@@ -94,8 +129,11 @@ private:
 	float m_mod_1_steps[NUMBER_SEQUENCE_STEPS] = {0};
 	float m_mod_2_steps[NUMBER_SEQUENCE_STEPS] = {0};
 
-	std::vector<std::pair<int, int>> m_active_keys_and_velocities = {};
-	std::vector<int> m_sustain_kill_list                          = {};
+	// all containers have a fixed size, so the audio thread never allocates
+	std::pair<int, int> m_active_keys_and_velocities[ARP_MAX_KEYS];
+	int m_number_of_active_keys = 0;
+	int m_sustain_kill_list[ARP_MAX_KEYS];
+	int m_sustain_kill_list_size = 0;
 
 	double m_samplerate          = -1;
 	double m_one_over_samplerate = -1;
@@ -112,8 +150,17 @@ private:
 	bool m_oneshot           = false;
 
 	//temp parametes
-	std::vector<std::pair<int, int>> m_arp_sequence;    //note, velocity
-	std::vector<std::pair<int, float>> m_playing_notes; //note, timer
+	std::pair<int, int> m_arp_sequence[ARP_MAX_SEQUENCE_LENGTH]; //note, velocity
+	int m_arp_sequence_length = 0;
+	std::pair<int, float> m_playing_notes[ARP_MAX_PLAYING_NOTES]; //note, timer
+	int m_number_of_playing_notes = 0;
+	// every key in every octave, the crawl patterns walk over this
+	std::pair<int, int> m_octave_keys[ARP_MAX_KEYS * ARP_MAX_OCTAVES];
+	ArpEvent m_events[ARP_MAX_EVENTS];
+	int m_number_of_events = 0;
+	int m_step_active      = -1;
+	// seeded once, std::random_device might do a system call
+	std::default_random_engine m_RNG;
 	int m_current_arp_index       = -1;
 	int m_current_sequence_index  = -1;
 	double m_time_since_last_note = 0.;
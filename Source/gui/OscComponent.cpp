@@ -1245,7 +1245,7 @@ void OscComponent::showNoiseComponents() {
 }
 
 void OscComponent::createWavedrawTables() {
-	m_WT_container->createWavedrawTable(std::stoi(m_osc_number) - 1, m_wavedraw.getDrawnTable(), 44100.f);
+	m_WT_container->requestWavedrawTable(std::stoi(m_osc_number) - 1, m_wavedraw.getDrawnTable(), m_WT_container->getSampleRate());
 
 	// write values to audiovaluetree
 	float *table = m_wavedraw.getDrawnTable();
@@ -1257,7 +1257,7 @@ void OscComponent::createWavedrawTables() {
 
 void OscComponent::createChipdrawTables() {
 
-	m_WT_container->createChipdrawTable(std::stoi(m_osc_number) - 1, m_chipdraw.getDrawnTable(), 44100.f);
+	m_WT_container->requestChipdrawTable(std::stoi(m_osc_number) - 1, m_chipdraw.getDrawnTable(), m_WT_container->getSampleRate());
 
 	// write values to audiovaluetree
 	float *table = m_chipdraw.getDrawnTable();
@@ -1268,7 +1268,7 @@ void OscComponent::createChipdrawTables() {
 }
 
 void OscComponent::createSpecdrawTables() {
-	m_WT_container->createSpecdrawTable(std::stoi(m_osc_number) - 1, m_specdraw.getDrawnTable(), 44100.f);
+	m_WT_container->requestSpecdrawTable(std::stoi(m_osc_number) - 1, m_specdraw.getDrawnTable(), m_WT_container->getSampleRate());
 	// write values to audiovaluetree
 	float *table = m_specdraw.getDrawnTable();
 	auto node    = m_value_tree.state.getChildWithName("draw");
@@ -729,14 +729,7 @@ void PatchBrowser::loadPatchFromOpenedFileStream(juce::FileInputStream &p_file_s
 		return;
 	}
 
-	// if we're reading an older patch version we set the default patch first
-	// since new params might not exist and will only be set
-	if (checkForSmallerVersion(p_file_stream, version_string)) {
-		DBG("Reading older patch, setting init patch first");
-		MemoryInputStream init_stream(BinaryData::init_patch_odin, BinaryData::init_patch_odinSize, false);
-		m_audio_processor.readPatch(ValueTree::readFromStream(init_stream));
-	}
-
+	// readPatch() fills older patches up from the init patch
 	//reset stream position
 	p_file_stream.setPosition(0);
 	m_audio_processor.readPatch(ValueTree::readFromStream(p_file_stream).createCopy());
@@ -771,18 +764,6 @@ bool PatchBrowser::checkForBiggerVersion(FileInputStream &p_file_stream, std::st
 	return false;
 }
 
-bool PatchBrowser::checkForSmallerVersion(FileInputStream &p_file_stream, std::string &p_version_string) {
-	p_file_stream.setPosition(0);
-	auto value_tree_read = ValueTree::readFromStream(p_file_stream);
-	int patch_version    = value_tree_read.getChildWithName("misc")["patch_migration_version"];
-	if (patch_version < ODIN_PATCH_MIGRATION_VERSION) {
-		p_version_string = "2." + std::to_string((int)value_tree_read.getChildWithName("misc")["version_minor"]) + "." +
-		                   std::to_string((int)value_tree_read.getChildWithName("misc")["version_patch"]);
-		return true;
-	}
-	return false;
-}
-
 void PatchBrowser::savePatchInOpenedFileStream(FileOutputStream &p_file_stream) {
 	// use this to overwrite old content
 	p_file_stream.setPosition(0);
@@ -43,7 +43,6 @@ private:
     void loadSoundbankWithFileBrowser(String p_directory);
 
     bool checkForBiggerVersion(FileInputStream &p_file_stream, std::string &p_version_string);
-    bool checkForSmallerVersion(FileInputStream &p_file_stream, std::string &p_version_string);
 
     bool usesWavedraw(int p_osc);
     bool usesChipdraw(int p_osc);
@@ -0,0 +1,58 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#include "ProfilerComponent.h"
+#include "../PluginProcessor.h"
+
+ProfilerComponent::ProfilerComponent(OdinAudioProcessor &p_processor) : m_processor(p_processor) {
+	setSize(PROFILER_SIZE_X, PROFILER_SIZE_Y);
+	// only a readout, don't block the knobs below it
+	setInterceptsMouseClicks(false, false);
+	m_last_snapshot = m_processor.m_profiler.getSnapshot();
+	startTimer(PROFILER_TIMER_MILLISECS);
+}
+
+void ProfilerComponent::timerCallback() {
+	const ModuleProfiler::Snapshot snapshot = m_processor.m_profiler.getSnapshot();
+	// nothing was rendered, keep the last values
+	if (snapshot.samples == m_last_snapshot.samples) {
+		return;
+	}
+
+	m_total_percent = 0.;
+	for (int module = 0; module < ModuleProfiler::NumberOfModules; ++module) {
+		m_percent[module] = snapshot.getPercent(module, m_last_snapshot, m_processor.getSampleRate());
+		m_total_percent += m_percent[module];
+	}
+	m_last_snapshot = snapshot;
+	repaint();
+}
+
+void ProfilerComponent::paint(Graphics &g) {
+	g.fillAll(Colours::black.withAlpha(0.7f));
+	g.setColour(Colours::white);
+	g.setFont(PROFILER_LINE_HEIGHT - 2);
+
+	auto drawLine = [&](int p_line, const String &p_name, double p_percent) {
+		const Rectangle<int> line(4, p_line * PROFILER_LINE_HEIGHT, getWidth() - 8, PROFILER_LINE_HEIGHT);
+		g.drawText(p_name, line, Justification::centredLeft);
+		g.drawText(String(p_percent, 2) + " %", line, Justification::centredRight);
+	};
+
+	for (int module = 0; module < ModuleProfiler::NumberOfModules; ++module) {
+		drawLine(module, ModuleProfiler::getModuleName(module), m_percent[module]);
+	}
+	drawLine(ModuleProfiler::NumberOfModules + 1, "total", m_total_percent);
+}
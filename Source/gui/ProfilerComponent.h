@@ -0,0 +1,43 @@
+/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+#pragma once
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include "../ModuleProfiler.h"
+
+#define PROFILER_TIMER_MILLISECS 500
+#define PROFILER_LINE_HEIGHT 12
+#define PROFILER_SIZE_X 130
+#define PROFILER_SIZE_Y ((ModuleProfiler::NumberOfModules + 2) * PROFILER_LINE_HEIGHT)
+
+class OdinAudioProcessor;
+
+// readout of the module timings in the top left corner of the editor, only shown in ODIN_PROFILING builds.
+// Shows the share of one CPU core each module used since the last update
+class ProfilerComponent : public Component, public Timer {
+public:
+	ProfilerComponent(OdinAudioProcessor &p_processor);
+
+	void paint(Graphics &) override;
+	void timerCallback() override;
+
+private:
+	OdinAudioProcessor &m_processor;
+
+	ModuleProfiler::Snapshot m_last_snapshot;
+	double m_percent[ModuleProfiler::NumberOfModules] = {0.};
+	double m_total_percent                            = 0.;
+};
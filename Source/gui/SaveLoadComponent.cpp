@@ -361,18 +361,6 @@ bool SaveLoadComponent::checkForBiggerVersion(FileInputStream &p_file_stream, st
 	return false;
 }
 
-bool SaveLoadComponent::checkForSmallerVersion(FileInputStream &p_file_stream, std::string &p_version_string) {
-	p_file_stream.setPosition(0);
-	auto value_tree_read = ValueTree::readFromStream(p_file_stream);
-	int patch_version    = value_tree_read.getChildWithName("misc")["patch_migration_version"];
-	if (patch_version < ODIN_PATCH_MIGRATION_VERSION) {
-		p_version_string = "2." + std::to_string((int)value_tree_read.getChildWithName("misc")["version_minor"]) + "." +
-		                   std::to_string((int)value_tree_read.getChildWithName("misc")["version_patch"]);
-		return true;
-	}
-	return false;
-}
-
 void SaveLoadComponent::setGUIBig() {
 
 	juce::Image up_1 = ImageCache::getFromMemory(BinaryData::buttonup_2_150_png, BinaryData::buttonup_2_150_pngSize);
@@ -552,14 +540,7 @@ void SaveLoadComponent::loadPatchFromOpenedFileStream(juce::FileInputStream &p_f
 		return;
 	}
 
-	// if we're reading an older patch version we set the default patch first
-	// since new params might not exist and will only be set
-	if (checkForSmallerVersion(p_file_stream, version_string)) {
-		DBG("Reading older patch, setting init patch first");
-		MemoryInputStream init_stream(BinaryData::init_patch_odin, BinaryData::init_patch_odinSize, false);
-		m_audio_processor.readPatch(ValueTree::readFromStream(init_stream));
-	}
-
+	// readPatch() fills older patches up from the init patch
 	//reset stream position
 	p_file_stream.setPosition(0);
 	m_audio_processor.readPatch(ValueTree::readFromStream(p_file_stream).createCopy());
@@ -69,7 +69,6 @@ private:
 
 	void loadPatchWithFileBrowser();
 	bool checkForBiggerVersion(FileInputStream &p_file_stream, std::string &p_version_string);
-	bool checkForSmallerVersion(FileInputStream &p_file_stream, std::string &p_version_string);
 	void versionMigrate();
 	void incrementPatch();
 	void decrementPatch();
@@ -209,17 +209,17 @@ void TuningComponent::exportKBMFileWithFileBrowser() {
 
 void TuningComponent::restoreSCL() {
 	DBG("restoreSCL()");
-	m_processor.m_tuning = Tunings::Tuning(Tunings::evenTemperament12NoteScale(), m_processor.m_tuning.keyboardMapping);
+	m_processor.setTuning(Tunings::Tuning(Tunings::evenTemperament12NoteScale(), m_processor.m_tuning.keyboardMapping));
 }
 
 void TuningComponent::restoreKBM() {
 	DBG("restoreKBM()");
-	m_processor.m_tuning =
-	    Tunings::Tuning(m_processor.m_tuning.scale, Tunings::tuneNoteTo(60, Tunings::MIDI_0_FREQ * 32.0));
+	m_processor.setTuning(
+	    Tunings::Tuning(m_processor.m_tuning.scale, Tunings::tuneNoteTo(60, Tunings::MIDI_0_FREQ * 32.0)));
 }
 
 void TuningComponent::resetEntireTuning() {
-	m_processor.m_tuning = Tunings::Tuning(Tunings::tuneNoteTo(60, Tunings::MIDI_0_FREQ * 32.0));
+	m_processor.setTuning(Tunings::Tuning(Tunings::tuneNoteTo(60, Tunings::MIDI_0_FREQ * 32.0)));
 }
 
 void TuningComponent::importKBMFromFileBrowser(String p_directory,
@@ -264,7 +264,7 @@ void TuningComponent::importKBMFromFileBrowser(String p_directory,
 			return;
 		}
 
-		m_processor.m_tuning = Tunings::Tuning(m_processor.m_tuning.scale, kbm_from_file);
+		m_processor.setTuning(Tunings::Tuning(m_processor.m_tuning.scale, kbm_from_file));
 	});
 }
 
@@ -309,8 +309,7 @@ void TuningComponent::importSCLFromFileBrowser(String p_directory,
 			return;
 		}
 
-		m_processor.m_tuning =
-		    Tunings::Tuning(Tunings::readSCLFile(file_name.toStdString()), m_processor.m_tuning.keyboardMapping);
+		m_processor.setTuning(Tunings::Tuning(scale_from_file, m_processor.m_tuning.keyboardMapping));
 	});
 }
 
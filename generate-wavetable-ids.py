@@ -0,0 +1,83 @@
+#!/usr/bin/env python
+
+#
+# This python script generates Source/audio/Oscillators/Wavetables/WavetableIDs.h
+# from the WT_NR defines of the coefficient headers included by
+# WavetableCoefficients.h. Run it from the repository root after adding or
+# renumbering a wavetable.
+#
+
+import os
+import re
+import sys
+
+OSC_DIR = os.path.join('Source', 'audio', 'Oscillators')
+OUTPUT = os.path.join(OSC_DIR, 'Wavetables', 'WavetableIDs.h')
+NUMBER_OF_WAVETABLES = 160
+
+HEADER = '''/*
+** Odin 2 Synthesizer Plugin
+** Copyright (C) 2020 - 2021 TheWaveWarden
+**
+** Odin 2 is free software: you can redistribute it and/or modify
+** it under the terms of the GNU General Public License as published by
+** the Free Software Foundation, either version 3 of the License, or
+** (at your option) any later version.
+**
+** Odin 2 is distributed in the hope that it will be useful,
+** but WITHOUT ANY WARRANTY; without even the implied warranty of
+** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+** GNU General Public License for more details.
+*/
+
+// generated by generate-wavetable-ids.py, don't edit by hand
+
+#pragma once
+'''
+
+
+def read_tables():
+    with open(os.path.join(OSC_DIR, 'WavetableCoefficients.h')) as f:
+        includes = re.findall(r'^#include "(Wavetables/Coefficients/\w+\.h)"', f.read(), re.M)
+
+    wavetables = {}
+    lfo_tables = {}
+    for include in includes:
+        with open(os.path.join(OSC_DIR, include)) as f:
+            content = f.read()
+        number = re.search(r'^#define WT_NR (\d+)', content, re.M)
+        name_1D = re.search(r'^m_wavetable_names_1D\[WT_NR\] = "(\w+)";', content, re.M)
+        name_LFO = re.search(r'^m_LFO_names\[WT_NR\] = "(\w+)";', content, re.M)
+        if not number or not (name_1D or name_LFO):
+            sys.stderr.write('Skipping ' + include + ', no WT_NR or name found\n')
+            continue
+
+        tables = wavetables if name_1D else lfo_tables
+        index = int(number.group(1))
+        if index in tables:
+            sys.stderr.write('WT_NR ' + str(index) + ' is used twice (' + include + ')\n')
+            sys.exit(1)
+        tables[index] = (name_1D or name_LFO).group(1)
+    return wavetables, lfo_tables
+
+
+def write_tables(out, namespace, array_name, size_define, tables):
+    out.write('\nnamespace ' + namespace + ' {\n')
+    out.write('enum : int {\n')
+    for index in sorted(tables):
+        out.write('\t' + tables[index] + ' = ' + str(index) + ',\n')
+    out.write('};\n')
+    out.write('}\n')
+
+    out.write('\n// name of each table, empty for unused indices\n')
+    out.write('constexpr const char *' + array_name + '[' + size_define + '] = {\n')
+    for index in range(NUMBER_OF_WAVETABLES):
+        out.write('\t"' + tables.get(index, '') + '",\n')
+    out.write('};\n')
+
+
+wavetables, lfo_tables = read_tables()
+with open(OUTPUT, 'w') as out:
+    out.write(HEADER)
+    write_tables(out, 'WavetableID', 'WAVETABLE_NAMES_1D', 'NUMBER_OF_WAVETABLES', wavetables)
+    write_tables(out, 'LFOTableID', 'LFO_TABLE_NAMES', 'NUMBER_OF_WAVETABLES', lfo_tables)